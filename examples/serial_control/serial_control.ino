@@ -8,18 +8,20 @@
  * This example allows you to control an LED strip using serial commands.
  * Connect to the serial monitor to send commands and control the LEDs.
  * 
- * Available Commands:
- * switch:on|off        - Turn LED strip ON or OFF
- * bright:1-5           - Set brightness level (1=low, 5=high)
- * fade:on|off          - Enable/disable fade-in effects
- * rgb:R_G_B            - Set solid color (e.g., rgb:255_0_0 for red)
- * color:ColorName      - Set solid color by name (e.g., color:LightGreen)
- * palette:palette_name - Set a color palette (e.g., palette:rainbow, palette:u01)
- * blend:1-5            - Set blend speed level (1=slowest, 5=fastest)
- * power:V_mA           - Set max power (e.g., power:5_500 for 5V, 500mA)
- * status               - Get immediate status report
- * config:save|load|check - Save, load, or check EEPROM config
- * help                 - Show this help message
+ * Commands are JSON objects, one per line. Several fields can be combined,
+ * e.g. {"bright":3,"palette":"ocean"}.
+ * {"switch":"on"}        - Turn LED strip ON or OFF ("on"/"off" or true/false)
+ * {"bright":3}           - Set brightness level 1-5 (1=low, 5=high)
+ * {"fade":"on"}          - Enable/disable fade-in effects
+ * {"rgb":[255,0,0]}      - Set solid color [R,G,B]
+ * {"color":"LightGreen"} - Set solid color by name
+ * {"palette":"rainbow"}  - Set a color palette (e.g. "rainbow", "u01")
+ * {"blend":3}            - Set blend speed level 1-5 (1=slowest, 5=fastest)
+ * {"power":[5,500]}      - Set max power [volts, mA]
+ * {"config":"save"}      - Save or load ("load") the EEPROM config
+ * status                 - Get immediate status report
+ * check                  - Check for a saved EEPROM config
+ * help                   - Show this help message
  */
 
 #include "AvantLumi.h"
@@ -66,124 +68,59 @@ void loop() {
 }
 
 void handleSerialCommand() {
-    String command = Serial.readStringUntil('\n');
-    command.trim();
-    command.toLowerCase();
-
-    String cmd;
-    String value;
-    int colonIndex = command.indexOf(':');
-    if (colonIndex != -1) {
-        cmd = command.substring(0, colonIndex);
-        value = command.substring(colonIndex + 1);
-    } else {
-        cmd = command;
+    // One line into a fixed buffer; the library parses it in place
+    char line[128];
+    size_t length = Serial.readBytesUntil('\n', line, sizeof(line) - 1);
+    while (length > 0 && (line[length - 1] == '\r' || line[length - 1] == ' ')) {
+        length--;
     }
+    line[length] = '\0';
 
-    if (cmd == "switch") {
-        if (myLumi.setSwitch(value)) {
-            Serial.println("Switch set to: " + value);
-        } else {
-            Serial.println("Invalid switch state. Use 'on' or 'off'");
-        }
-    } else if (cmd == "bright") {
-        int level = value.toInt();
-        if (myLumi.setBright(level)) {
-            Serial.println("Brightness set to level: " + String(level));
-        } else {
-            Serial.println("Invalid brightness level. Use 1-5");
-        }
-    } else if (cmd == "fade") {
-        if (myLumi.setFade(value)) {
-            Serial.println("Fade set to: " + value);
-        } else {
-            Serial.println("Invalid fade state. Use 'on' or 'off'");
-        }
-    } else if (cmd == "rgb") {
-        int r, g, b;
-        if (sscanf(value.c_str(), "%d_%d_%d", &r, &g, &b) == 3) {
-            if (myLumi.setRGB(r, g, b)) {
-                Serial.println("RGB set to: " + String(r) + "," + String(g) + "," + String(b));
-            } else {
-                Serial.println("Failed to set RGB. Values must be 0-255.");
-            }
-        } else {
-            Serial.println("Invalid RGB format. Use R_G_B (e.g., 255_0_0)");
-        }
-    } else if (cmd == "palette") {
-        if (myLumi.setPalette(value)) {
-            Serial.println("Palette set to: " + value);
-        } else {
-            Serial.println("Invalid palette name: " + value);
-        }
-    } else if (cmd == "color") {
-        if (myLumi.setColor(value)) {
-            Serial.println("Color set to: " + value);
-        } else {
-            Serial.println("Invalid color name: " + value);
-        }
-    } else if (cmd == "blend") {
-        int speedLevel = value.toInt();
-        if (myLumi.setBlendSpeed(speedLevel)) {
-            Serial.println("Blend speed set to level: " + String(speedLevel));
-        } else {
-            Serial.println("Invalid blend speed level. Use 1-5");
-        }
-    } else if (cmd == "status") {
+    if (strcmp(line, "help") == 0) {
+        printHelp();
+    } else if (strcmp(line, "status") == 0) {
         Serial.println("Status: " + myLumi.getStatus());
-    } else if (cmd == "config") {
-        if (value == "save") {
-            if (myLumi.saveConfig()) {
-                Serial.println("Configuration saved to EEPROM.");
-            } else {
-                Serial.println("Failed to save configuration.");
-            }
-        } else if (value == "load") {
-            if (myLumi.loadConfig()) {
-                Serial.println("Configuration loaded from EEPROM.");
-                Serial.println("New Status: " + myLumi.getStatus());
-            } else {
-                Serial.println("No valid configuration found in EEPROM.");
-            }
-        } else if (value == "check") {
-            if (myLumi.checkConfig()) {
-                Serial.println("Valid configuration found in EEPROM.");
-            } else {
-                Serial.println("No valid configuration found in EEPROM.");
-            }
+    } else if (strcmp(line, "check") == 0) {
+        if (myLumi.checkConfig()) {
+            Serial.println("Valid configuration found in EEPROM.");
         } else {
-            Serial.println("Invalid config command. Use 'save', 'load', or 'check'.");
+            Serial.println("No valid configuration found in EEPROM.");
         }
-    } else if (cmd == "power") {
-        int v, ma;
-        if (sscanf(value.c_str(), "%d_%d", &v, &ma) == 2) {
-            if (myLumi.setMaxPower(v, ma)) {
-                Serial.println("Max power set to: " + String(v) + "V, " + String(ma) + "mA");
-            } else {
-                Serial.println("Invalid power settings.");
-            }
+    } else {
+        LumiCommandResult result = myLumi.applyCommand(line, length);
+        if (result.error == LUMI_CMD_OK) {
+            Serial.print("Applied ");
+            Serial.print(result.applied);
+            Serial.println(" field(s). Status: " + myLumi.getStatus());
         } else {
-            Serial.println("Invalid power format. Use V_mA (e.g., 5_500)");
+            Serial.print("Error: ");
+            Serial.print(AvantLumi::commandErrorText(result.error));
+            if (result.field) {
+                Serial.print(" for '");
+                Serial.write((const uint8_t*)result.field, result.fieldLength);
+                Serial.print("'");
+            }
+            Serial.print(" at column ");
+            Serial.print(result.offset + 1);
+            Serial.println(". Type 'help' for available commands.");
         }
-    } else if (cmd == "help") {
-        printHelp();
-    } else {
-        Serial.println("Unknown command. Type 'help' for available commands.");
     }
 }
 
 void printHelp() {
     Serial.println("\n--- AvantLumi Serial Control Commands ---");
-    Serial.println("switch:on|off        - Turn LED strip ON or OFF");
-    Serial.println("bright:1-5           - Set brightness level (1=low, 5=high)");
-    Serial.println("fade:on|off          - Enable/disable fade-in effects");
-    Serial.println("rgb:R_G_B            - Set solid color (e.g., rgb:255_0_0 for red)");
-    Serial.println("color:ColorName      - Set solid color by name (e.g., color:LightGreen)");
-    Serial.println("palette:palette_name - Set a color palette (e.g., palette:rainbow, palette:u01)");
-    Serial.println("blend:1-5            - Set blend speed level (1=slowest, 5=fastest)");
-    Serial.println("power:V_mA           - Set max power (e.g., power:5_500 for 5V, 500mA)");
-    Serial.println("status               - Get immediate status report");
-    Serial.println("config:save|load|check - Save, load, or check EEPROM config");
-    Serial.println("help                 - Show this help message");
+    Serial.println("One JSON object per line, e.g. {\"bright\":3,\"palette\":\"ocean\"}");
+    Serial.println("{\"switch\":\"on\"}        - Turn LED strip ON or OFF");
+    Serial.println("{\"bright\":3}           - Set brightness level 1-5 (1=low, 5=high)");
+    Serial.println("{\"fade\":\"on\"}          - Enable/disable fade-in effects");
+    Serial.println("{\"rgb\":[255,0,0]}      - Set solid color [R,G,B]");
+    Serial.println("{\"color\":\"LightGreen\"} - Set solid color by name");
+    Serial.println("{\"palette\":\"rainbow\"}  - Set a color palette (e.g. \"rainbow\", \"u01\")");
+    Serial.println("{\"blend\":3}            - Set blend speed level 1-5 (1=slowest, 5=fastest)");
+    Serial.println("{\"power\":[5,500]}      - Set max power [volts, mA]");
+    Serial.println("{\"config\":\"save\"}      - Save or load (\"load\") the EEPROM config");
+    Serial.println("status                 - Get immediate status report");
+    Serial.println("check                  - Check for a saved EEPROM config");
+    Serial.println("help                   - Show this help message");
     Serial.println("-----------------------------------------");
 }
@@ -1,343 +1,157 @@
-#ifndef WEBPAGE_H
-#define WEBPAGE_H
+// Generated by tools/embed_asset.py from webpage.html - do not edit.
+// 10332 bytes of source, 2205 bytes gzip-compressed.
 
-// HTML content for the web interface
-const char webpage_html[] PROGMEM = R"rawliteral(
-<!DOCTYPE html>
-<html>
-<head>
-  <title>AvantLumi Control Panel</title>
-  <meta name="viewport" content="width=device-width, initial-scale=1">
-  <style>
-    body {
-      font-family: Arial, sans-serif;
-      background-color: #f4f4f4;
-      color: #333;
-      margin: 0;
-      padding: 20px;
-    }
-    .container {
-      max-width: 800px;
-      margin: 0 auto;
-      background-color: #fff;
-      padding: 20px;
-      border-radius: 5px;
-      box-shadow: 0 2px 5px rgba(0,0,0,0.1);
-    }
-    h1 {
-      color: #0056b3;
-      text-align: center;
-    }
-    .control-group {
-      margin-bottom: 20px;
-      padding: 15px;
-      border: 1px solid #ddd;
-      border-radius: 5px;
-    }
-    .control-group h3 {
-      margin-top: 0;
-      color: #0056b3;
-    }
-    .switch {
-      position: relative;
-      display: inline-block;
-      width: 60px;
-      height: 34px;
-    }
-    .switch input {
-      opacity: 0;
-      width: 0;
-      height: 0;
-    }
-    .slider {
-      position: absolute;
-      cursor: pointer;
-      top: 0;
-      left: 0;
-      right: 0;
-      bottom: 0;
-      background-color: #ccc;
-      transition: .4s;
-      border-radius: 34px;
-    }
-    .slider:before {
-      position: absolute;
-      content: "";
-      height: 26px;
-      width: 26px;
-      left: 4px;
-      bottom: 4px;
-      background-color: white;
-      transition: .4s;
-      border-radius: 50%;
-    }
-    input:checked + .slider {
-      background-color: #0056b3;
-    }
-    input:checked + .slider:before {
-      transform: translateX(26px);
-    }
-    .range-slider {
-      width: 100%;
-      margin: 10px 0;
-    }
-    .rgb-inputs {
-      display: flex;
-      gap: 10px;
-      margin-bottom: 10px;
-    }
-    .rgb-inputs input {
-      flex: 1;
-      padding: 8px;
-      border: 1px solid #ddd;
-      border-radius: 4px;
-    }
-    select {
-      width: 100%;
-      padding: 8px;
-      margin-bottom: 10px;
-      border: 1px solid #ddd;
-      border-radius: 4px;
-    }
-    button {
-      background-color: #0056b3;
-      color: white;
-      border: none;
-      padding: 10px 15px;
-      border-radius: 4px;
-      cursor: pointer;
-      font-size: 16px;
-    }
-    button:hover {
-      background-color: #004494;
-    }
-    .config-buttons {
-      display: flex;
-      gap: 10px;
-      margin-top: 10px;
-    }
-    .config-buttons button {
-      flex: 1;
-    }
-    .status {
-      text-align: center;
-      margin-top: 20px;
-      padding: 10px;
-      background-color: #e9f7ef;
-      border-radius: 4px;
-    }
-  </style>
-</head>
-<body>
-  <div class="container">
-    <h1>AvantLumi Control Panel</h1>
-    
-    <div class="control-group">
-      <h3>Power Control</h3>
-      <label class="switch">
-        <input type="checkbox" id="switch" onchange="updateControl()">
-        <span class="slider"></span>
-      </label>
-      <span id="switch-status">OFF</span>
-    </div>
-    
-    <div class="control-group">
-      <h3>Brightness</h3>
-      <input type="range" min="1" max="5" value="3" class="range-slider" id="brightness" onchange="updateControl()">
-      <span id="brightness-value">3</span>
-    </div>
-    
-    <div class="control-group">
-      <h3>Fade Effect</h3>
-      <label class="switch">
-        <input type="checkbox" id="fade" onchange="updateControl()">
-        <span class="slider"></span>
-      </label>
-      <span id="fade-status">OFF</span>
-    </div>
-    
-    <div class="control-group">
-      <h3>RGB Color</h3>
-      <div class="rgb-inputs">
-        <input type="number" id="red" min="0" max="255" value="255" placeholder="Red">
-        <input type="number" id="green" min="0" max="255" value="0" placeholder="Green">
-        <input type="number" id="blue" min="0" max="255" value="0" placeholder="Blue">
-      </div>
-      <button onclick="applyRGB()">Apply RGB</button>
-    </div>
-    
-    <div class="control-group">
-      <h3>Color Name</h3>
-      <select id="color-name">
-        <option value="red">Red</option>
-        <option value="green">Green</option>
-        <option value="blue">Blue</option>
-        <option value="yellow">Yellow</option>
-        <option value="orange">Orange</option>
-        <option value="purple">Purple</option>
-        <option value="pink">Pink</option>
-        <option value="white">White</option>
-        <option value="cyan">Cyan</option>
-        <option value="magenta">Magenta</option>
-      </select>
-      <button onclick="applyColor()">Apply Color</button>
-    </div>
-    
-    <div class="control-group">
-      <h3>Color Palette</h3>
-      <select id="palette">
-        <option value="rainbow">Rainbow</option>
-        <option value="party">Party</option>
-        <option value="ocean">Ocean</option>
-        <option value="heat">Heat</option>
-        <option value="christmas">Christmas</option>
-        <option value="halloween">Halloween</option>
-        <option value="cyberpunk">Cyberpunk</option>
-        <option value="random">Random</option>
-      </select>
-      <button onclick="applyPalette()">Apply Palette</button>
-    </div>
-    
-    <div class="control-group">
-      <h3>Blend Speed</h3>
-      <input type="range" min="1" max="5" value="3" class="range-slider" id="blend-speed" onchange="updateControl()">
-      <span id="blend-speed-value">3</span>
-    </div>
-    
-    <div class="control-group">
-      <h3>Configuration</h3>
-      <div class="config-buttons">
-        <button onclick="saveConfig()">Save Config</button>
-        <button onclick="loadConfig()">Load Config</button>
-      </div>
-    </div>
-    
-    <div class="status" id="status">
-      Ready
-    </div>
-  </div>
+#ifndef WEBPAGE_HTML_H
+#define WEBPAGE_HTML_H
 
-  <script>
-    // Update control values when sliders or switches change
-    function updateControl() {
-      document.getElementById('brightness-value').textContent = document.getElementById('brightness').value;
-      document.getElementById('blend-speed-value').textContent = document.getElementById('blend-speed').value;
-      document.getElementById('switch-status').textContent = document.getElementById('switch').checked ? 'ON' : 'OFF';
-      document.getElementById('fade-status').textContent = document.getElementById('fade').checked ? 'ON' : 'OFF';
-      
-      // Send update to ESP32
-      const switchState = document.getElementById('switch').checked ? 'on' : 'off';
-      const brightness = document.getElementById('brightness').value;
-      const fadeState = document.getElementById('fade').checked ? 'on' : 'off';
-      const blendSpeed = document.getElementById('blend-speed').value;
-      
-      fetch(`/control?switch=${switchState}&bright=${brightness}&fade=${fadeState}&blend_spd=${blendSpeed}`)
-        .then(response => response.text())
-        .then(data => {
-          document.getElementById('status').textContent = data;
-        })
-        .catch(error => {
-          document.getElementById('status').textContent = 'Error: ' + error;
-        });
-    }
-    
-    // Apply RGB color
-    function applyRGB() {
-      const red = document.getElementById('red').value;
-      const green = document.getElementById('green').value;
-      const blue = document.getElementById('blue').value;
-      
-      fetch(`/control?rgb=${red},${green},${blue}`)
-        .then(response => response.text())
-        .then(data => {
-          document.getElementById('status').textContent = data;
-        })
-        .catch(error => {
-          document.getElementById('status').textContent = 'Error: ' + error;
-        });
-    }
-    
-    // Apply color by name
-    function applyColor() {
-      const colorName = document.getElementById('color-name').value;
-      
-      fetch(`/control?color=${colorName}`)
-        .then(response => response.text())
-        .then(data => {
-          document.getElementById('status').textContent = data;
-        })
-        .catch(error => {
-          document.getElementById('status').textContent = 'Error: ' + error;
-        });
-    }
-    
-    // Apply color palette
-    function applyPalette() {
-      const palette = document.getElementById('palette').value;
-      
-      fetch(`/control?palette=${palette}`)
-        .then(response => response.text())
-        .then(data => {
-          document.getElementById('status').textContent = data;
-        })
-        .catch(error => {
-          document.getElementById('status').textContent = 'Error: ' + error;
-        });
-    }
-    
-    // Save configuration
-    function saveConfig() {
-      fetch('/control?config=save')
-        .then(response => response.text())
-        .then(data => {
-          document.getElementById('status').textContent = data;
-        })
-        .catch(error => {
-          document.getElementById('status').textContent = 'Error: ' + error;
-        });
-    }
-    
-    // Load configuration
-    function loadConfig() {
-      fetch('/control?config=load')
-        .then(response => response.text())
-        .then(data => {
-          document.getElementById('status').textContent = data;
-        })
-        .catch(error => {
-          document.getElementById('status').textContent = 'Error: ' + error;
-        });
-    }
-    
-    // Initialize the page with current status
-    window.onload = function() {
-      fetch('/status')
-        .then(response => response.json())
-        .then(data => {
-          if (data.switch === 'on') {
-            document.getElementById('switch').checked = true;
-          }
-          document.getElementById('brightness').value = data.bright || 3;
-          document.getElementById('brightness-value').textContent = data.bright || 3;
-          
-          if (data.fade === 'on') {
-            document.getElementById('fade').checked = true;
-          }
-          
-          document.getElementById('blend-speed').value = data.blend_spd || 3;
-          document.getElementById('blend-speed-value').textContent = data.blend_spd || 3;
-          
-          // Update status text
-          document.getElementById('switch-status').textContent = data.switch === 'on' ? 'ON' : 'OFF';
-          document.getElementById('fade-status').textContent = data.fade === 'on' ? 'ON' : 'OFF';
-        })
-        .catch(error => {
-          document.getElementById('status').textContent = 'Error loading status: ' + error;
-        });
-    };
-  </script>
-</body>
-</html>
-)rawliteral";
+#include "LumiAsset.h"
 
-#endif // WEBPAGE_H
\ No newline at end of file
+const uint8_t webpage_html_gz[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x5a, 0x59, 0x73, 0xe3, 0x36,
+  0x12, 0x7e, 0xcf, 0xaf, 0xc0, 0x72, 0xb2, 0x91, 0x5c, 0x19, 0x5d, 0x96, 0x3d, 0x49, 0x64, 0x49,
+  0xa9, 0xb1, 0xd7, 0xce, 0x51, 0xc9, 0xd8, 0x35, 0xce, 0xd6, 0x26, 0x4f, 0x09, 0x44, 0x82, 0x12,
+  0x62, 0x8a, 0x60, 0x91, 0xa0, 0x64, 0x65, 0xe2, 0xff, 0xbe, 0xdd, 0x00, 0x48, 0x82, 0xd4, 0x41,
+  0xfa, 0xc8, 0x9b, 0xcb, 0x55, 0x22, 0x04, 0x36, 0xfa, 0xfa, 0x3e, 0x34, 0x1b, 0x94, 0xc7, 0xff,
+  0xfa, 0xcf, 0xf5, 0xc5, 0x2f, 0xbf, 0xdd, 0x5c, 0x92, 0x85, 0x5c, 0x06, 0xd3, 0xcf, 0xc6, 0xd9,
+  0x85, 0x51, 0x6f, 0xfa, 0x19, 0x21, 0x63, 0xc9, 0x65, 0xc0, 0xa6, 0xef, 0x57, 0x34, 0x94, 0x3f,
+  0xa5, 0x4b, 0x4e, 0x2e, 0x44, 0x28, 0x63, 0x11, 0x90, 0x1b, 0x1a, 0xb2, 0x60, 0xdc, 0xd3, 0xb7,
+  0x51, 0x70, 0xc9, 0x24, 0x25, 0x21, 0x5d, 0xb2, 0x89, 0xb3, 0xe2, 0x6c, 0x1d, 0x89, 0x58, 0x3a,
+  0xc4, 0x05, 0x69, 0x16, 0xca, 0x89, 0xb3, 0xe6, 0x9e, 0x5c, 0x4c, 0x3c, 0xb6, 0xe2, 0x2e, 0xeb,
+  0xa8, 0x2f, 0x6f, 0x09, 0x0f, 0xb9, 0xe4, 0x34, 0xe8, 0x24, 0x2e, 0x0d, 0xd8, 0x64, 0xe0, 0x28,
+  0x35, 0x89, 0xdc, 0x68, 0x85, 0x84, 0xcc, 0x84, 0xb7, 0x21, 0x9f, 0xd4, 0x90, 0x10, 0x1f, 0x34,
+  0x75, 0x7c, 0xba, 0xe4, 0xc1, 0x66, 0x44, 0xde, 0xc7, 0xb0, 0xee, 0x2d, 0x49, 0x68, 0x98, 0x74,
+  0x12, 0x16, 0x73, 0xff, 0xcc, 0x48, 0xcd, 0xa8, 0x7b, 0x37, 0x8f, 0x45, 0x1a, 0x7a, 0x1d, 0x57,
+  0x04, 0x22, 0x1e, 0x91, 0x37, 0xfe, 0x09, 0xfe, 0x65, 0x02, 0xd9, 0xec, 0x70, 0x38, 0xcc, 0xa6,
+  0x96, 0x34, 0x9e, 0xf3, 0x70, 0x44, 0xfa, 0xd9, 0x44, 0x44, 0x3d, 0x8f, 0x87, 0xf3, 0x11, 0x39,
+  0xee, 0x47, 0xf7, 0x7a, 0xf2, 0x41, 0x7d, 0x76, 0x31, 0x1c, 0xca, 0x43, 0x16, 0xe7, 0x6e, 0x2d,
+  0xe9, 0xbd, 0x0e, 0x67, 0x44, 0xbe, 0xee, 0xe7, 0xe2, 0x96, 0x52, 0x42, 0x53, 0x29, 0x0e, 0xb9,
+  0xe7, 0xfb, 0x07, 0xec, 0x62, 0x12, 0x62, 0x8f, 0xc5, 0x9d, 0x98, 0x7a, 0x3c, 0x4d, 0x46, 0xe4,
+  0xd4, 0xbe, 0x73, 0xdf, 0x49, 0x16, 0xd4, 0x13, 0x6b, 0x34, 0x73, 0x1c, 0xdd, 0xe3, 0x4d, 0x12,
+  0xcf, 0x67, 0xb4, 0xdd, 0x7f, 0xab, 0xfe, 0xba, 0x83, 0x23, 0xdb, 0xfd, 0xc5, 0x20, 0x77, 0x3b,
+  0xb3, 0xde, 0xef, 0x9f, 0xbe, 0x9b, 0xe5, 0x99, 0x90, 0xec, 0x5e, 0x76, 0x68, 0xc0, 0xe7, 0xe0,
+  0xb8, 0x0b, 0xb0, 0xb1, 0x78, 0x2b, 0x7a, 0x80, 0xbe, 0x83, 0x11, 0x44, 0x56, 0x06, 0x30, 0xd2,
+  0xce, 0x4c, 0x48, 0x29, 0x96, 0x65, 0xdf, 0xf3, 0x80, 0x06, 0xa7, 0xd5, 0x80, 0x60, 0x0e, 0x9c,
+  0x4d, 0x44, 0xc0, 0x3d, 0xf2, 0xc6, 0xf3, 0xbc, 0xba, 0x70, 0x77, 0xba, 0xb0, 0x18, 0x56, 0xbd,
+  0x90, 0x22, 0xb2, 0x80, 0xdc, 0x15, 0xa5, 0x51, 0x94, 0xac, 0xb9, 0x74, 0x17, 0xf9, 0xf2, 0x48,
+  0x24, 0xc0, 0x45, 0x01, 0x71, 0xc7, 0x2c, 0xa0, 0x92, 0xaf, 0x58, 0xa6, 0xc3, 0xe3, 0x49, 0x14,
+  0x50, 0xe0, 0x1c, 0x0f, 0x03, 0x40, 0xbe, 0x33, 0x0b, 0x84, 0x7b, 0x97, 0xdd, 0x34, 0xc8, 0xbf,
+  0xb3, 0x62, 0x5e, 0x30, 0x3e, 0x5f, 0xc8, 0x11, 0x19, 0x9e, 0x54, 0x5c, 0x37, 0x16, 0x79, 0x18,
+  0xa5, 0x32, 0xb7, 0x2b, 0x22, 0xea, 0x72, 0xb9, 0xb1, 0x7c, 0x36, 0x2a, 0xfb, 0x55, 0x7d, 0xfd,
+  0xb2, 0x32, 0xc8, 0x9b, 0xc5, 0xc2, 0xc2, 0x7d, 0x3a, 0x83, 0x9c, 0xa6, 0x32, 0x77, 0xdf, 0x4d,
+  0xe3, 0x04, 0x73, 0x10, 0x09, 0x5e, 0xe0, 0x09, 0x48, 0x97, 0xf2, 0x14, 0x30, 0x5f, 0x5a, 0x5f,
+  0xe3, 0x92, 0x45, 0xc4, 0x44, 0x43, 0xdb, 0x3f, 0x40, 0x63, 0xd7, 0x75, 0x73, 0xdd, 0x31, 0x6c,
+  0x4b, 0xe3, 0x4e, 0xf7, 0x24, 0xd9, 0x83, 0xec, 0x76, 0x7e, 0x54, 0x48, 0xa3, 0x19, 0xf3, 0x45,
+  0xcc, 0x9a, 0x44, 0xa6, 0x4b, 0xcb, 0x88, 0x38, 0x4e, 0x35, 0x57, 0xc7, 0xef, 0x0a, 0x3c, 0x4c,
+  0x3e, 0xed, 0x29, 0x1d, 0xee, 0x89, 0x4d, 0x49, 0x1d, 0xa0, 0x3d, 0xb5, 0x15, 0xe2, 0x7a, 0xc1,
+  0x0b, 0xe3, 0xcd, 0x62, 0x3c, 0xed, 0xff, 0xdb, 0x0e, 0x51, 0x41, 0x3f, 0x72, 0x17, 0xcc, 0xbd,
+  0x63, 0x1e, 0xf9, 0x72, 0x0b, 0xc5, 0x1d, 0x69, 0xdd, 0x66, 0xee, 0x1e, 0x25, 0xd5, 0xbc, 0x29,
+  0x07, 0x61, 0x06, 0xa2, 0x52, 0x43, 0x20, 0x35, 0xfb, 0xb5, 0x8d, 0x59, 0x28, 0x95, 0x84, 0x2e,
+  0xdc, 0x9b, 0xb3, 0x4e, 0xc5, 0x11, 0x93, 0xb3, 0x41, 0x3f, 0xf3, 0xbf, 0xa8, 0x67, 0x03, 0xa0,
+  0x7a, 0x85, 0x8b, 0x50, 0x71, 0x3a, 0xca, 0xab, 0x24, 0x57, 0x90, 0x6f, 0x1a, 0x3f, 0x60, 0x79,
+  0x4a, 0xe7, 0x34, 0xd2, 0xeb, 0xcf, 0x76, 0x57, 0x8e, 0x41, 0xb5, 0xda, 0x5a, 0x8a, 0xcb, 0xbb,
+  0x06, 0xb5, 0x82, 0xfc, 0x56, 0x99, 0xf9, 0xfa, 0x89, 0x55, 0xa6, 0x42, 0xc5, 0x84, 0x05, 0xcc,
+  0x95, 0x87, 0xb2, 0xb1, 0xcb, 0xe2, 0xde, 0x68, 0x9e, 0xe7, 0xcc, 0x2c, 0x05, 0x7d, 0x61, 0x53,
+  0x8e, 0xe4, 0x35, 0xaf, 0xc4, 0xd6, 0xcc, 0x7e, 0x28, 0x42, 0xb6, 0x5d, 0x9b, 0x11, 0xd1, 0xed,
+  0x02, 0xbd, 0xed, 0xcf, 0xde, 0x62, 0xa2, 0x1e, 0xcd, 0x09, 0xff, 0x8b, 0x81, 0xb2, 0x77, 0xbb,
+  0xbc, 0x1f, 0x2d, 0xc4, 0xaa, 0x8e, 0xe7, 0x27, 0x27, 0xdf, 0x9c, 0x54, 0x4b, 0xbd, 0xcf, 0xe7,
+  0x1d, 0xad, 0xe1, 0x89, 0xd4, 0x52, 0x65, 0x6e, 0xb0, 0xe3, 0x29, 0x6e, 0x6b, 0xae, 0x64, 0xb8,
+  0x44, 0xae, 0xac, 0x36, 0x49, 0x2a, 0xd3, 0xc2, 0x87, 0x7d, 0xcf, 0xc9, 0xb2, 0xdd, 0xdd, 0x4f,
+  0xc2, 0xfe, 0xa1, 0x1a, 0xf3, 0x86, 0x7d, 0xe3, 0x7f, 0xc5, 0xfc, 0x26, 0xcc, 0x18, 0xf7, 0x4c,
+  0xa7, 0x34, 0xee, 0xe9, 0x5e, 0x6d, 0x8c, 0xed, 0x92, 0x6a, 0xa1, 0x3c, 0xbe, 0x22, 0x6e, 0x40,
+  0x93, 0x64, 0xe2, 0xe4, 0x0d, 0x8b, 0xa3, 0x5b, 0xaa, 0xf1, 0x62, 0xb0, 0xbf, 0x97, 0x83, 0x7b,
+  0x4a, 0x48, 0x4b, 0x56, 0xb4, 0xe4, 0x4f, 0x5d, 0xa3, 0x09, 0x75, 0x0d, 0xa7, 0x37, 0x62, 0x0d,
+  0xc0, 0x1a, 0x3d, 0xa0, 0x61, 0x98, 0xdf, 0x0c, 0xe8, 0x8c, 0x05, 0x99, 0x02, 0xfd, 0xec, 0xcb,
+  0x57, 0xc2, 0x6d, 0xbd, 0xa1, 0xe5, 0x26, 0x82, 0x76, 0x51, 0x15, 0x33, 0xe8, 0x66, 0x1c, 0xc2,
+  0xbd, 0x5c, 0x96, 0x88, 0xd0, 0x5d, 0x60, 0x71, 0x9a, 0x38, 0x69, 0xe4, 0x41, 0xf5, 0x32, 0x46,
+  0xda, 0x47, 0xb6, 0x9a, 0x24, 0xa2, 0x61, 0x6e, 0x44, 0x15, 0x31, 0x67, 0x0a, 0x99, 0x81, 0xd9,
+  0xdc, 0x91, 0x9e, 0xf2, 0x24, 0xff, 0xaa, 0x56, 0x14, 0x76, 0x3a, 0x1a, 0x5a, 0x67, 0x7a, 0x7d,
+  0x75, 0x65, 0x2f, 0x1c, 0xf7, 0x20, 0xfe, 0x47, 0xa7, 0xe3, 0x5c, 0x3d, 0x3a, 0x43, 0x96, 0x24,
+  0xa5, 0x5c, 0xd8, 0xc1, 0xaa, 0x82, 0xeb, 0x90, 0x25, 0x0f, 0x27, 0xce, 0xc0, 0xc1, 0xfe, 0x71,
+  0xe2, 0x9c, 0x3a, 0x64, 0x45, 0x83, 0x14, 0xee, 0x0e, 0x9d, 0xcc, 0x88, 0x5d, 0x98, 0x75, 0x62,
+  0x66, 0xb9, 0xf2, 0x26, 0xc9, 0x29, 0x02, 0x2d, 0xd6, 0x75, 0x94, 0x15, 0x67, 0x3a, 0x7c, 0x7e,
+  0xa4, 0x57, 0xd4, 0x63, 0xe4, 0xd2, 0xf7, 0xa1, 0x50, 0xbe, 0x0c, 0xec, 0x3e, 0x28, 0xfc, 0xe7,
+  0x41, 0x47, 0x2b, 0x2f, 0x0b, 0xf9, 0xc7, 0xef, 0xce, 0x81, 0xff, 0xb0, 0x7b, 0x4b, 0x69, 0xb0,
+  0x96, 0x16, 0x4f, 0xb1, 0x7d, 0x89, 0x08, 0xd3, 0xe5, 0x2c, 0x03, 0x39, 0x66, 0x9e, 0x21, 0x47,
+  0xdf, 0x90, 0xe3, 0xf8, 0xb4, 0xa0, 0x87, 0x1a, 0x43, 0xf9, 0x73, 0xd9, 0x42, 0x04, 0x10, 0xf7,
+  0xc4, 0xf9, 0x08, 0xf2, 0x0d, 0xd4, 0xce, 0x63, 0xc6, 0xc2, 0x03, 0x8a, 0xfb, 0x15, 0xb5, 0xdf,
+  0x29, 0xf9, 0x06, 0x8a, 0x67, 0x48, 0xa8, 0xe6, 0x7a, 0xcf, 0x15, 0xff, 0x72, 0x94, 0xf2, 0x84,
+  0xc3, 0x17, 0x53, 0x86, 0x81, 0x01, 0x01, 0x77, 0xef, 0x26, 0x0e, 0x8d, 0xa2, 0x60, 0x03, 0xd9,
+  0x45, 0xec, 0xdf, 0xe3, 0x98, 0xc0, 0x97, 0x71, 0x4f, 0x8b, 0x3d, 0x07, 0x31, 0x85, 0x16, 0xf9,
+  0x00, 0x27, 0xd5, 0x12, 0x64, 0xe6, 0xa9, 0x8f, 0x41, 0xa9, 0x6a, 0xdc, 0xc1, 0xb3, 0xac, 0x9d,
+  0x02, 0x11, 0x61, 0xbf, 0x97, 0x45, 0x86, 0x40, 0x4d, 0x21, 0xfb, 0xe3, 0x9e, 0x9e, 0xdf, 0x2b,
+  0xa8, 0x53, 0x3f, 0x55, 0x19, 0xad, 0x15, 0x56, 0xe9, 0x9c, 0x62, 0x96, 0x6a, 0x45, 0x37, 0x2c,
+  0x08, 0xc4, 0xda, 0x99, 0xfe, 0xa6, 0xae, 0xb5, 0xe2, 0x42, 0x17, 0x9e, 0xe9, 0xb5, 0xba, 0xd6,
+  0x8a, 0x47, 0x69, 0x1c, 0x05, 0x20, 0x7e, 0xa3, 0xae, 0xf5, 0xe2, 0x3c, 0xbc, 0x03, 0x61, 0xf8,
+  0xac, 0x15, 0x55, 0x9d, 0x89, 0x33, 0xfd, 0x1f, 0x5e, 0x6a, 0x85, 0xdd, 0x0d, 0x85, 0xdc, 0x5d,
+  0xc0, 0x67, 0xad, 0xe8, 0x92, 0xce, 0xe1, 0x51, 0x4c, 0x9d, 0xe9, 0xcf, 0x7a, 0x50, 0x5d, 0x00,
+  0x5b, 0x5d, 0x21, 0x7c, 0x98, 0x70, 0x8a, 0x1c, 0x05, 0xe5, 0xcc, 0xce, 0x7e, 0x29, 0xd2, 0xdd,
+  0xd0, 0x80, 0x49, 0xb9, 0x97, 0x77, 0x91, 0xbe, 0x7d, 0x80, 0x74, 0xf0, 0x2c, 0x9f, 0x21, 0xe8,
+  0x1f, 0xf5, 0xa0, 0x1e, 0x17, 0x1a, 0xcb, 0x0d, 0x00, 0x83, 0x97, 0x7a, 0x8a, 0xb8, 0x0c, 0xb3,
+  0x7d, 0x8d, 0x97, 0x5a, 0x61, 0x68, 0x3a, 0xa4, 0x33, 0xfd, 0x1e, 0x3e, 0xeb, 0x41, 0x5c, 0xc4,
+  0x3c, 0x91, 0x4b, 0x0a, 0x05, 0xf0, 0x22, 0x1b, 0xd6, 0xeb, 0xa7, 0x48, 0x6b, 0xb5, 0x75, 0xbe,
+  0xcf, 0x86, 0x0d, 0xe8, 0x02, 0x85, 0x29, 0x4a, 0x91, 0x8b, 0x17, 0xd9, 0xb0, 0x76, 0x11, 0x6c,
+  0x08, 0x4f, 0x2c, 0x31, 0xa7, 0x78, 0x7d, 0x1a, 0x6d, 0x0c, 0xb0, 0x05, 0x71, 0x72, 0xa4, 0x9f,
+  0x4f, 0x9d, 0xf3, 0x80, 0x85, 0x1e, 0xb9, 0x8d, 0x18, 0x16, 0x9b, 0x97, 0xef, 0x2a, 0x50, 0x7b,
+  0x27, 0x41, 0xed, 0x8f, 0x6c, 0x2b, 0x8a, 0x85, 0x2f, 0xd8, 0x57, 0x5c, 0xa8, 0xde, 0x3c, 0x8d,
+  0x29, 0x62, 0xb0, 0xef, 0x91, 0x5a, 0x6e, 0xe0, 0xed, 0xed, 0x52, 0x05, 0x27, 0xa1, 0x2b, 0xa6,
+  0x55, 0x62, 0x0c, 0xb7, 0xf0, 0x8d, 0xe8, 0xaf, 0x65, 0x60, 0x76, 0xae, 0x0d, 0x04, 0xf5, 0x8a,
+  0xb5, 0x3f, 0xc1, 0xb7, 0x3d, 0x6b, 0xad, 0x48, 0x0f, 0x05, 0x6d, 0xda, 0x0e, 0xdd, 0x7c, 0x9a,
+  0x16, 0xc4, 0x68, 0xf8, 0x08, 0x1d, 0xfc, 0xa6, 0xac, 0xc0, 0x0c, 0xd4, 0x2b, 0x51, 0x37, 0xe6,
+  0x91, 0x21, 0x60, 0xaf, 0x47, 0xfe, 0xab, 0xa0, 0x21, 0x26, 0x87, 0x1a, 0xe3, 0x04, 0x0e, 0x7c,
+  0x2c, 0x24, 0x1a, 0xd8, 0x84, 0x40, 0xa9, 0xd1, 0xbd, 0x17, 0xdc, 0xd0, 0x88, 0xaa, 0xc5, 0x7e,
+  0x1a, 0xba, 0x8a, 0xf9, 0x15, 0x74, 0x8b, 0xc3, 0x95, 0x70, 0xd3, 0x25, 0x14, 0xcf, 0xee, 0x9c,
+  0xc9, 0xcb, 0x80, 0xe1, 0xf0, 0x7c, 0xf3, 0x83, 0xd7, 0x6e, 0x55, 0x7b, 0xc8, 0xd6, 0x51, 0x17,
+  0x0f, 0x41, 0x17, 0xfa, 0x1d, 0x0c, 0x99, 0x34, 0x59, 0x09, 0x6b, 0xd4, 0xda, 0xb3, 0x5a, 0x63,
+  0x55, 0x66, 0x3d, 0xc2, 0x5a, 0xb1, 0xb4, 0xb1, 0xb9, 0xd2, 0x41, 0xa0, 0xb9, 0x29, 0xbd, 0x0c,
+  0xe4, 0xb3, 0x77, 0x31, 0xdf, 0x92, 0xd6, 0xf5, 0x87, 0x16, 0x19, 0xc1, 0xe5, 0xea, 0xaa, 0x55,
+  0x6b, 0xd6, 0x6a, 0x45, 0x9b, 0x1b, 0xc5, 0x45, 0xb5, 0x26, 0xcd, 0x05, 0xa8, 0x72, 0x8b, 0x95,
+  0x43, 0x83, 0x4d, 0xa4, 0x20, 0x97, 0xb7, 0x37, 0xc3, 0xe3, 0xe2, 0xf5, 0x59, 0x22, 0x0d, 0x4b,
+  0x6e, 0x25, 0x0a, 0x3c, 0x32, 0x56, 0x11, 0x2a, 0xc3, 0xc2, 0xf7, 0x5b, 0x67, 0x25, 0x9d, 0x05,
+  0xe2, 0x4f, 0xe3, 0x85, 0xd6, 0x82, 0x91, 0xd6, 0xfa, 0xb5, 0x9d, 0x8e, 0xfd, 0x5e, 0x21, 0x33,
+  0x54, 0x11, 0x7d, 0x22, 0x7f, 0xb2, 0xd7, 0x03, 0x0c, 0x32, 0xd1, 0xfe, 0xa3, 0x67, 0xb6, 0xdf,
+  0xb7, 0x3a, 0x35, 0x93, 0xcf, 0x3f, 0x59, 0xa9, 0x7c, 0xf8, 0x42, 0x47, 0x07, 0xb3, 0x45, 0x98,
+  0x0f, 0x5f, 0xa0, 0xb7, 0x30, 0x95, 0x47, 0x06, 0x62, 0x68, 0xee, 0xf7, 0x24, 0xf2, 0x50, 0x32,
+  0x77, 0xf0, 0xe1, 0x8f, 0xa3, 0xbc, 0x2a, 0x75, 0x25, 0xec, 0xeb, 0x76, 0xcc, 0x92, 0x08, 0xa2,
+  0x80, 0x5c, 0x4c, 0x49, 0x36, 0x56, 0x94, 0x69, 0x1f, 0x55, 0x45, 0x01, 0x6b, 0x8a, 0x62, 0x9f,
+  0xf2, 0xf9, 0x43, 0xd4, 0xdf, 0x43, 0x3f, 0xd0, 0x71, 0x96, 0xaf, 0x7f, 0xb0, 0x4c, 0xb8, 0x14,
+  0xa3, 0x67, 0x71, 0x0c, 0x15, 0xe6, 0x99, 0x46, 0x5a, 0x97, 0xa8, 0x05, 0xb0, 0x22, 0x5f, 0x12,
+  0xa5, 0xd0, 0xb6, 0x68, 0xbf, 0x7d, 0xc9, 0xea, 0x5e, 0x7e, 0x08, 0xd0, 0xef, 0xb8, 0xca, 0x15,
+  0xad, 0x38, 0x2d, 0x58, 0xbf, 0x71, 0x20, 0xee, 0xf1, 0x61, 0xc0, 0xe3, 0x6d, 0xa0, 0xf5, 0x3a,
+  0xd5, 0xb6, 0x1f, 0x5a, 0xa9, 0x04, 0x76, 0xaf, 0xc5, 0x2e, 0xfe, 0x30, 0xcb, 0x54, 0x4d, 0x6b,
+  0x42, 0x2f, 0x38, 0x3d, 0x02, 0x37, 0xc0, 0xcb, 0x87, 0xb7, 0x9f, 0x7f, 0x52, 0x26, 0x71, 0x80,
+  0x0a, 0x5e, 0x59, 0x72, 0x80, 0x25, 0x8a, 0x21, 0x64, 0xb6, 0x51, 0x3f, 0x48, 0xee, 0x60, 0x8a,
+  0x69, 0xf3, 0x2b, 0x5c, 0x51, 0xab, 0xf0, 0x60, 0x78, 0x08, 0xbc, 0xe2, 0x70, 0xd8, 0x10, 0x42,
+  0xb5, 0x00, 0x40, 0xcc, 0xb5, 0xbf, 0x22, 0x57, 0x8b, 0x9c, 0x39, 0x09, 0xed, 0x40, 0x2e, 0xef,
+  0xb4, 0x2b, 0xd8, 0x99, 0x15, 0x87, 0x90, 0x33, 0x22, 0x0d, 0x61, 0x33, 0xd2, 0x00, 0x9c, 0x19,
+  0xbd, 0xc2, 0xb6, 0x13, 0x36, 0xd5, 0x54, 0xbb, 0x76, 0xdb, 0x5e, 0x46, 0xcd, 0x6e, 0xc1, 0x8b,
+  0x97, 0xec, 0x2a, 0xd9, 0x2d, 0x6b, 0x8f, 0xa0, 0xc0, 0x04, 0x65, 0x5b, 0xaf, 0x59, 0xde, 0x91,
+  0x65, 0x75, 0xfc, 0x38, 0x90, 0x65, 0xfb, 0xb0, 0x52, 0x97, 0x65, 0x94, 0x7d, 0xcd, 0xf2, 0xfe,
+  0x12, 0x44, 0x89, 0xf9, 0xbd, 0xe7, 0xc7, 0xdb, 0xeb, 0x0f, 0x44, 0xcc, 0xfe, 0xc4, 0xf7, 0x33,
+  0xd0, 0x3e, 0x43, 0xf0, 0xd9, 0xa9, 0x2b, 0xd9, 0x51, 0x99, 0x6e, 0xd5, 0x22, 0x95, 0x9d, 0x06,
+  0x27, 0xaa, 0xad, 0x96, 0x5a, 0xe7, 0x24, 0xfb, 0x37, 0x81, 0xc9, 0x64, 0xa2, 0x9a, 0xd9, 0xb3,
+  0xe6, 0x27, 0xb3, 0xac, 0xae, 0x65, 0x9a, 0xf4, 0x1d, 0xf2, 0xf7, 0xdf, 0x64, 0x78, 0xf6, 0xfc,
+  0xf3, 0xdd, 0x1e, 0x8d, 0x4d, 0x4e, 0x39, 0xdb, 0x41, 0xe2, 0xec, 0x56, 0x88, 0x8f, 0x38, 0x16,
+  0x6e, 0x85, 0x9a, 0xf5, 0xd1, 0x0d, 0xa3, 0xad, 0x3f, 0x60, 0xee, 0xd7, 0x5a, 0x9c, 0xae, 0xcc,
+  0x41, 0xdc, 0x90, 0x05, 0x15, 0x3c, 0xf3, 0xa8, 0xb9, 0x03, 0xff, 0x17, 0x3d, 0x55, 0x6e, 0xa5,
+  0x7e, 0xa7, 0xf6, 0xf2, 0x96, 0xf8, 0x41, 0xff, 0x93, 0x16, 0xff, 0x8b, 0x29, 0xfe, 0x47, 0x74,
+  0xce, 0x08, 0x85, 0x53, 0xa5, 0x2f, 0xf0, 0xa5, 0x5c, 0x16, 0xbc, 0x7e, 0xc9, 0x90, 0x90, 0x28,
+  0x4d, 0x16, 0x00, 0x33, 0x34, 0x5e, 0xd6, 0x66, 0x09, 0x98, 0x6e, 0xd6, 0xd7, 0x3c, 0xf4, 0xc4,
+  0xba, 0x2b, 0x42, 0x2c, 0x40, 0xe0, 0x4f, 0xb6, 0x7d, 0xac, 0x8a, 0xc5, 0x7d, 0xd2, 0x36, 0x62,
+  0x97, 0x2b, 0xf0, 0xfa, 0x56, 0xa4, 0xb1, 0xcb, 0x8e, 0xac, 0x2a, 0xa0, 0x9f, 0xf6, 0x0c, 0x6f,
+  0xe2, 0xf9, 0x32, 0x64, 0x6b, 0x62, 0x49, 0x42, 0xb1, 0xd3, 0xb7, 0x5a, 0x47, 0xc5, 0x5e, 0xd7,
+  0x33, 0x60, 0x77, 0x09, 0xfc, 0x46, 0xff, 0x2d, 0xd3, 0x25, 0xdd, 0xa4, 0xb4, 0x91, 0x71, 0xf7,
+  0x77, 0x23, 0x1a, 0x27, 0xac, 0xcd, 0xba, 0x6a, 0x57, 0x5b, 0x3a, 0x1f, 0x8a, 0x61, 0xcc, 0x64,
+  0x1a, 0x87, 0xd9, 0xf7, 0x87, 0x5d, 0x5d, 0x45, 0xab, 0x97, 0x41, 0xd2, 0xa4, 0xea, 0xfe, 0x99,
+  0x60, 0x4e, 0xaa, 0xa2, 0x96, 0x6b, 0xff, 0x64, 0xb5, 0x54, 0x4f, 0x12, 0x1e, 0xce, 0x0d, 0xb2,
+  0x87, 0x8b, 0xe7, 0x99, 0xfe, 0x21, 0xda, 0xbc, 0x9f, 0x1a, 0xf7, 0xf4, 0x4f, 0xd0, 0xe3, 0x9e,
+  0xfe, 0x27, 0xc2, 0xff, 0x03, 0x5a, 0x5c, 0xb2, 0xae, 0x5c, 0x28, 0x00, 0x00,
+};
+
+const LumiAsset webpage_html = {
+  webpage_html_gz,
+  sizeof(webpage_html_gz),
+  "text/html",
+  "\"bf7ea9b1059795c9\""
+};
+
+#endif // WEBPAGE_HTML_H
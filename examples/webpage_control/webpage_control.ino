@@ -27,7 +27,7 @@
  * - Color palette selection (rainbow, party, ocean, etc.)
  * - Blend speed slider (1-5 levels)
  * - Save/Load configuration buttons
- * - Real-time status updates
+ * - Real-time status updates pushed from the ESP32 (Server-Sent Events on /events)
  * 
  * USAGE NOTES:
  * - The web interface is responsive and works on both desktop and mobile devices
@@ -52,6 +52,7 @@
 #include "AvantLumi.h"
 #include <WiFi.h>
 #include <WebServer.h>
+#include "LumiStatusStream.h"
 #include <ArduinoJson.h>
 #include "webpage.h"
 
@@ -71,6 +72,7 @@ const char* password = "YOUR_WIFI_PASSWORD"; // UPDATE: Your WiFi password
 // ================================
 AvantLumi ledController(LED_DATA_PIN, NUM_LEDS);
 WebServer server(80);
+LumiStatusStream<WiFiClient> dashboards;   // Open /events pages
 
 // ================================
 // SETUP FUNCTION
@@ -95,6 +97,10 @@ void setup() {
     Serial.println("No saved configuration found, using defaults");
   }
   
+  // Slider and color picker drags send many requests per second;
+  // apply only the latest value of each setting once per frame
+  ledController.setCoalescing(true);
+  
   // Connect to WiFi
   setupWiFi();
   
@@ -115,6 +121,9 @@ void loop() {
   
   // Update LED controller
   ledController.update();
+  
+  // Push status changes to the dashboards
+  dashboards.update(ledController);
 }
 
 // ================================
@@ -152,6 +161,12 @@ void setupWebServer() {
   // Handle status requests
   server.on("/status", HTTP_GET, handleStatus);
   
+  // Push status changes to open dashboards (Server-Sent Events)
+  server.on("/events", HTTP_GET, handleEvents);
+  
+  // Needed so handleRoot() can answer 304 for a cached page
+  lumiCollectAssetHeaders(server);
+  
   // Start the server
   server.begin();
   Serial.println("HTTP server started");
@@ -161,7 +176,8 @@ void setupWebServer() {
 // WEB PAGE HANDLER
 // ================================
 void handleRoot() {
-  server.send_P(200, "text/html", webpage_html);
+  // Gzip-compressed page from webpage.h (regenerate with tools/embed_asset.py)
+  lumiSendAsset(server, webpage_html);
 }
 
 // ================================
@@ -274,6 +290,18 @@ void handleStatus() {
   server.send(200, "application/json", statusJson);
 }
 
+// ================================
+// STATUS EVENTS HANDLER
+// ================================
+void handleEvents() {
+  // The stream keeps the connection and sends the status JSON whenever it changes
+  WiFiClient client = server.client();
+  client.setNoDelay(true);
+  if (!dashboards.addClient(client, ledController)) {
+    server.send(503, "text/plain", "Too many dashboards connected");
+  }
+}
+
 // ================================
 // AVAILABLE COMMANDS REFERENCE
 // ================================
@@ -1,360 +1,180 @@
-// HTML content for the web interface
-const char webpage_html[] PROGMEM = R"rawliteral(
-<!DOCTYPE html>
-<html lang="en">
-<head>
-    <meta charset="UTF-8">
-    <meta name="viewport" content="width=device-width, initial-scale=1.0">
-    <title>AvantLumi LED Control</title>
-    <style>
-        body {
-            font-family: Arial, sans-serif;
-            max-width: 800px;
-            margin: 0 auto;
-            padding: 20px;
-            background-color: #f5f5f5;
-        }
-        .container {
-            background-color: white;
-            border-radius: 10px;
-            padding: 20px;
-            box-shadow: 0 2px 10px rgba(0,0,0,0.1);
-        }
-        h1 {
-            color: #333;
-            text-align: center;
-            margin-bottom: 30px;
-        }
-        .control-group {
-            margin-bottom: 20px;
-            padding: 15px;
-            border: 1px solid #ddd;
-            border-radius: 5px;
-        }
-        .control-group h3 {
-            margin-top: 0;
-            color: #444;
-            border-bottom: 1px solid #eee;
-            padding-bottom: 10px;
-        }
-        .control-row {
-            display: flex;
-            align-items: center;
-            margin-bottom: 15px;
-        }
-        .control-row label {
-            flex: 1;
-            font-weight: bold;
-        }
-        .control-row input, .control-row select, .control-row button {
-            flex: 2;
-            padding: 8px;
-            border-radius: 4px;
-            border: 1px solid #ddd;
-        }
-        .control-row button {
-            background-color: #4CAF50;
-            color: white;
-            border: none;
-            cursor: pointer;
-            transition: background-color 0.3s;
-        }
-        .control-row button:hover {
-            background-color: #45a049;
-        }
-        .status {
-            background-color: #e9f7ef;
-            padding: 10px;
-            border-radius: 5px;
-            margin-top: 20px;
-        }
-        .mqtt-status {
-            display: flex;
-            align-items: center;
-            margin-bottom: 10px;
-        }
-        .mqtt-status-indicator {
-            width: 12px;
-            height: 12px;
-            border-radius: 50%;
-            margin-right: 10px;
-            background-color: #ff0000;
-        }
-        .mqtt-status-indicator.connected {
-            background-color: #00ff00;
-        }
-        .rgb-inputs {
-            display: flex;
-            gap: 10px;
-        }
-        .rgb-inputs input {
-            flex: 1;
-        }
-        .config-buttons {
-            display: flex;
-            gap: 10px;
-        }
-        .config-buttons button {
-            flex: 1;
-        }
-        .config-buttons button.save {
-            background-color: #2196F3;
-        }
-        .config-buttons button.load {
-            background-color: #FF9800;
-        }
-        .config-buttons button.save:hover {
-            background-color: #0b7dda;
-        }
-        .config-buttons button.load:hover {
-            background-color: #e68a00;
-        }
-    </style>
-</head>
-<body>
-    <div class="container">
-        <h1>AvantLumi LED Control</h1>
-        
-        <div class="control-group">
-            <h3>Power Control</h3>
-            <div class="control-row">
-                <label>Power Switch:</label>
-                <select id="switch">
-                    <option value="off">OFF</option>
-                    <option value="on">ON</option>
-                </select>
-            </div>
-        </div>
-        
-        <div class="control-group">
-            <h3>Brightness & Effects</h3>
-            <div class="control-row">
-                <label>Brightness (1-5):</label>
-                <input type="range" id="bright" min="1" max="5" value="3">
-            </div>
-            <div class="control-row">
-                <label>Fade Effect:</label>
-                <select id="fade">
-                    <option value="off">OFF</option>
-                    <option value="on">ON</option>
-                </select>
-            </div>
-            <div class="control-row">
-                <label>Blend Speed (1-5):</label>
-                <input type="range" id="blend_spd" min="1" max="5" value="3">
-            </div>
-        </div>
-        
-        <div class="control-group">
-            <h3>Color Control</h3>
-            <div class="control-row">
-                <label>RGB Color:</label>
-                <div class="rgb-inputs">
-                    <input type="number" id="rgb_r" min="0" max="255" placeholder="R">
-                    <input type="number" id="rgb_g" min="0" max="255" placeholder="G">
-                    <input type="number" id="rgb_b" min="0" max="255" placeholder="B">
-                </div>
-            </div>
-            <div class="control-row">
-                <label>Color Name:</label>
-                <select id="color">
-                    <option value="">Select a color</option>
-                    <option value="red">Red</option>
-                    <option value="green">Green</option>
-                    <option value="blue">Blue</option>
-                    <option value="white">White</option>
-                    <option value="black">Black (Off)</option>
-                    <option value="yellow">Yellow</option>
-                    <option value="orange">Orange</option>
-                    <option value="pink">Pink</option>
-                    <option value="purple">Purple</option>
-                    <option value="cyan">Cyan</option>
-                    <option value="magenta">Magenta</option>
-                    <option value="lime">Lime</option>
-                    <option value="maroon">Maroon</option>
-                    <option value="olive">Olive</option>
-                    <option value="navy">Navy</option>
-                    <option value="teal">Teal</option>
-                    <option value="silver">Silver</option>
-                    <option value="gold">Gold</option>
-                    <option value="brown">Brown</option>
-                    <option value="coral">Coral</option>
-                    <option value="salmon">Salmon</option>
-                    <option value="crimson">Crimson</option>
-                    <option value="indigo">Indigo</option>
-                    <option value="violet">Violet</option>
-                    <option value="turquoise">Turquoise</option>
-                    <option value="khaki">Khaki</option>
-                    <option value="plum">Plum</option>
-                    <option value="orchid">Orchid</option>
-                    <option value="tan">Tan</option>
-                    <option value="hotpink">Hot Pink</option>
-                    <option value="forestgreen">Forest Green</option>
-                </select>
-            </div>
-            <div class="control-row">
-                <label>Color Palette:</label>
-                <select id="palette">
-                    <option value="">Select a palette</option>
-                    <option value="rainbow">Rainbow</option>
-                    <option value="party">Party</option>
-                    <option value="ocean">Ocean</option>
-                    <option value="heat">Heat</option>
-                    <option value="christmas">Christmas</option>
-                    <option value="halloween">Halloween</option>
-                    <option value="cyberpunk">Cyberpunk</option>
-                    <option value="random">Random</option>
-                </select>
-            </div>
-        </div>
-        
-        <div class="control-group">
-            <h3>Configuration</h3>
-            <div class="control-row">
-                <label>Save/Load Settings:</label>
-                <div class="config-buttons">
-                    <button class="save" onclick="saveConfig()">Save Config</button>
-                    <button class="load" onclick="loadConfig()">Load Config</button>
-                </div>
-            </div>
-        </div>
-        
-        <div class="status">
-            <h3>Status</h3>
-            <div class="mqtt-status">
-                <div class="mqtt-status-indicator" id="mqtt-indicator"></div>
-                <span id="mqtt-status-text">MQTT: Disconnected</span>
-            </div>
-            <div id="status-content">Loading status...</div>
-        </div>
-    </div>
+// Generated by tools/embed_asset.py from webpage.html - do not edit.
+// 13196 bytes of source, 2570 bytes gzip-compressed.
 
-    <script>
-        // Get status from the ESP32
-        function getStatus() {
-            fetch('/status')
-                .then(response => response.json())
-                .then(data => {
-                    updateUI(data);
-                    document.getElementById('status-content').textContent = JSON.stringify(data, null, 2);
-                })
-                .catch(error => {
-                    console.error('Error getting status:', error);
-                    document.getElementById('status-content').textContent = 'Error getting status';
-                });
-        }
-        
-        // Update UI with current status
-        function updateUI(data) {
-            // Update power switch
-            document.getElementById('switch').value = data.switch || 'off';
-            
-            // Update brightness
-            document.getElementById('bright').value = data.bright || 3;
-            
-            // Update fade
-            document.getElementById('fade').value = data.fade || 'off';
-            
-            // Update blend speed
-            document.getElementById('blend_spd').value = data.blend_spd || 3;
-            
-            // Update RGB if available
-            if (data.rgb) {
-                document.getElementById('rgb_r').value = data.rgb.r || 0;
-                document.getElementById('rgb_g').value = data.rgb.g || 0;
-                document.getElementById('rgb_b').value = data.rgb.b || 0;
-            }
-            
-            // Update MQTT status
-            if (data.mqtt && data.mqtt.connected) {
-                document.getElementById('mqtt-indicator').classList.add('connected');
-                document.getElementById('mqtt-status-text').textContent = 'MQTT: Connected to ' + (data.mqtt.server || 'unknown');
-            } else {
-                document.getElementById('mqtt-indicator').classList.remove('connected');
-                document.getElementById('mqtt-status-text').textContent = 'MQTT: Disconnected';
-            }
-        }
-        
-        // Send control command
-        function sendControl(params) {
-            let url = '/control?' + params;
-            fetch(url)
-                .then(response => response.text())
-                .then(data => {
-                    console.log('Control response:', data);
-                    // Refresh status after a short delay
-                    setTimeout(getStatus, 500);
-                })
-                .catch(error => {
-                    console.error('Error sending control:', error);
-                });
-        }
-        
-        // Save configuration
-        function saveConfig() {
-            sendControl('config=save');
-        }
-        
-        // Load configuration
-        function loadConfig() {
-            sendControl('config=load');
-        }
-        
-        // Set up event listeners
-        document.addEventListener('DOMContentLoaded', function() {
-            // Get initial status
-            getStatus();
-            
-            // Set up periodic status updates
-            setInterval(getStatus, 5000);
-            
-            // Power switch
-            document.getElementById('switch').addEventListener('change', function() {
-                sendControl('switch=' + this.value);
-            });
-            
-            // Brightness
-            document.getElementById('bright').addEventListener('input', function() {
-                sendControl('bright=' + this.value);
-            });
-            
-            // Fade
-            document.getElementById('fade').addEventListener('change', function() {
-                sendControl('fade=' + this.value);
-            });
-            
-            // Blend speed
-            document.getElementById('blend_spd').addEventListener('input', function() {
-                sendControl('blend_spd=' + this.value);
-            });
-            
-            // RGB inputs
-            function updateRGB() {
-                const r = document.getElementById('rgb_r').value || 0;
-                const g = document.getElementById('rgb_g').value || 0;
-                const b = document.getElementById('rgb_b').value || 0;
-                sendControl('rgb=' + r + ',' + g + ',' + b);
-            }
-            
-            document.getElementById('rgb_r').addEventListener('input', updateRGB);
-            document.getElementById('rgb_g').addEventListener('input', updateRGB);
-            document.getElementById('rgb_b').addEventListener('input', updateRGB);
-            
-            // Color selection
-            document.getElementById('color').addEventListener('change', function() {
-                if (this.value) {
-                    sendControl('color=' + this.value);
-                }
-            });
-            
-            // Palette selection
-            document.getElementById('palette').addEventListener('change', function() {
-                if (this.value) {
-                    sendControl('palette=' + this.value);
-                }
-            });
-        });
-    </script>
-</body>
-</html>
-)rawliteral";
\ No newline at end of file
+#ifndef WEBPAGE_HTML_H
+#define WEBPAGE_HTML_H
+
+#include "LumiAsset.h"
+
+const uint8_t webpage_html_gz[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x1b, 0xdb, 0x72, 0xdb, 0xb8,
+  0xf5, 0x3d, 0x5f, 0x81, 0x32, 0xd3, 0x48, 0x9a, 0x5a, 0x37, 0xcb, 0xde, 0x4d, 0x64, 0x49, 0x9d,
+  0x58, 0xb1, 0x93, 0xb4, 0x4e, 0xec, 0x46, 0x4e, 0x3b, 0xfb, 0xb4, 0x03, 0x91, 0x20, 0x89, 0x86,
+  0xb7, 0x25, 0x41, 0xd9, 0x9e, 0xdd, 0xfc, 0x7b, 0xcf, 0x01, 0x28, 0x89, 0xa2, 0x28, 0x91, 0x90,
+  0x95, 0xce, 0xda, 0x13, 0x82, 0x24, 0x70, 0xee, 0x57, 0x80, 0xce, 0xe8, 0x2f, 0xef, 0x6e, 0xa7,
+  0xf7, 0xbf, 0xdc, 0x5d, 0x11, 0x57, 0xf8, 0xde, 0xe4, 0xc5, 0x08, 0x07, 0xe2, 0xd1, 0xc0, 0x19,
+  0x1b, 0x2c, 0x30, 0xf0, 0x05, 0xa3, 0xd6, 0xe4, 0x05, 0x81, 0x9f, 0x91, 0xcf, 0x04, 0x25, 0xa6,
+  0x4b, 0xe3, 0x84, 0x89, 0xb1, 0xf1, 0xf5, 0xfe, 0xba, 0xfd, 0xda, 0xc8, 0x4f, 0x05, 0xd4, 0x67,
+  0x63, 0x63, 0xc1, 0xd9, 0x43, 0x14, 0xc6, 0xc2, 0x20, 0x66, 0x18, 0x08, 0x16, 0xc0, 0xd2, 0x07,
+  0x6e, 0x09, 0x77, 0x6c, 0xb1, 0x05, 0x37, 0x59, 0x5b, 0x3e, 0x9c, 0x10, 0x1e, 0x70, 0xc1, 0xa9,
+  0xd7, 0x4e, 0x4c, 0xea, 0xb1, 0x71, 0xbf, 0xd3, 0x5b, 0xa2, 0x12, 0x5c, 0x78, 0x6c, 0xf2, 0x76,
+  0x41, 0x03, 0x71, 0x93, 0xfa, 0x9c, 0xdc, 0x5c, 0xbd, 0x23, 0x53, 0xc0, 0x14, 0x87, 0xde, 0xa8,
+  0xab, 0x26, 0xd5, 0xc2, 0x44, 0x3c, 0x2d, 0xef, 0xf1, 0x67, 0x1e, 0x5a, 0x4f, 0xe4, 0xf7, 0xd5,
+  0x23, 0xfe, 0xd8, 0x00, 0xd6, 0xb6, 0xa9, 0xcf, 0xbd, 0xa7, 0x21, 0x79, 0x1b, 0x03, 0xb9, 0x13,
+  0x92, 0xd0, 0x20, 0x69, 0x27, 0x2c, 0xe6, 0xf6, 0xc5, 0xc6, 0x5a, 0x9f, 0x3e, 0x2a, 0xd6, 0x86,
+  0xe4, 0x75, 0xaf, 0x17, 0x3d, 0x16, 0x67, 0x63, 0x87, 0x07, 0x43, 0xd2, 0x23, 0x34, 0x15, 0xe1,
+  0xe6, 0x5c, 0x44, 0x2d, 0x8b, 0x07, 0xce, 0x90, 0x9c, 0x6e, 0x81, 0xcd, 0xa9, 0xf9, 0xcd, 0x89,
+  0xc3, 0x34, 0xb0, 0xda, 0x66, 0xe8, 0x85, 0xf1, 0x90, 0xbc, 0xb4, 0xcf, 0xf1, 0x77, 0xbd, 0xec,
+  0xfb, 0xea, 0xae, 0x83, 0xfa, 0xa2, 0x3c, 0x60, 0x71, 0x41, 0x8c, 0x6d, 0x2c, 0x0f, 0x2e, 0x17,
+  0xac, 0x40, 0x2a, 0x8c, 0x2d, 0x16, 0xb7, 0x63, 0x6a, 0xf1, 0x34, 0x19, 0x92, 0xfe, 0x16, 0x2f,
+  0xfb, 0xd8, 0x0c, 0x1f, 0xdb, 0x89, 0x4b, 0xad, 0xf0, 0x01, 0x25, 0x3c, 0x8d, 0x1e, 0x25, 0x38,
+  0x89, 0x9d, 0x39, 0x6d, 0xf6, 0x4e, 0xe4, 0x6f, 0xa7, 0xdf, 0x2a, 0xe3, 0xd9, 0xed, 0x17, 0x78,
+  0x5d, 0x8a, 0x39, 0x18, 0x0c, 0x36, 0x69, 0x08, 0xf6, 0x28, 0xda, 0xd4, 0xe3, 0x0e, 0x68, 0xd1,
+  0x04, 0xaf, 0x60, 0x71, 0x99, 0x86, 0xdb, 0xf3, 0x50, 0x88, 0xd0, 0x1f, 0x92, 0xc1, 0x06, 0x93,
+  0x05, 0x25, 0x81, 0x2b, 0xb4, 0x51, 0x21, 0x51, 0x81, 0x78, 0x01, 0xc7, 0xe9, 0x6e, 0x1d, 0xf4,
+  0xcf, 0xb7, 0x75, 0x80, 0xfa, 0x83, 0x19, 0x10, 0x3c, 0x09, 0x3d, 0x6e, 0x91, 0x97, 0x96, 0x65,
+  0xed, 0xd5, 0xf1, 0x79, 0x2d, 0x16, 0xdd, 0x41, 0x39, 0x97, 0x22, 0x8c, 0x40, 0xdb, 0x17, 0xa5,
+  0xda, 0x3b, 0x3b, 0x3b, 0x2b, 0xa5, 0xbc, 0x94, 0x2c, 0xc7, 0x24, 0x63, 0xac, 0x54, 0xc6, 0xf5,
+  0xda, 0x2a, 0x4d, 0xc6, 0xe1, 0x43, 0x81, 0x43, 0x8b, 0x27, 0x91, 0x47, 0x21, 0x66, 0x6c, 0x8f,
+  0x15, 0xd4, 0x24, 0x2d, 0xd8, 0x06, 0xef, 0xf3, 0x93, 0x5a, 0x76, 0xec, 0x9f, 0xd7, 0xa0, 0xee,
+  0xd1, 0x39, 0xf3, 0x8a, 0xb1, 0x0b, 0xa4, 0x01, 0xfc, 0x62, 0x3b, 0xa0, 0x1f, 0x18, 0x77, 0x5c,
+  0x31, 0x04, 0x9d, 0x78, 0x56, 0x25, 0x6a, 0x1e, 0x44, 0xa9, 0x38, 0xd9, 0x7c, 0x97, 0x30, 0x8f,
+  0x99, 0xc5, 0x97, 0xf3, 0x14, 0x18, 0x0e, 0x4a, 0x99, 0x38, 0xdd, 0xe1, 0x44, 0xaf, 0xcb, 0x7d,
+  0x68, 0xe5, 0x1f, 0x67, 0xba, 0x3e, 0xb6, 0x43, 0x86, 0x52, 0xd6, 0x4a, 0x52, 0xcb, 0xd9, 0xf4,
+  0xed, 0xf5, 0x79, 0xb9, 0x47, 0xed, 0x4c, 0x18, 0x43, 0x12, 0x84, 0x41, 0x61, 0xc6, 0x4c, 0xe3,
+  0x04, 0x81, 0xa2, 0x90, 0x6f, 0xdb, 0x57, 0xc4, 0x90, 0x40, 0x21, 0x75, 0x87, 0x10, 0xc7, 0x45,
+  0x1e, 0x48, 0xaf, 0x33, 0x48, 0x6a, 0x8a, 0x33, 0x74, 0xc3, 0x45, 0x8d, 0x4c, 0xf7, 0xf2, 0xec,
+  0x9c, 0xf6, 0xce, 0xde, 0x94, 0x22, 0x4d, 0x04, 0x15, 0x69, 0x52, 0x8d, 0x82, 0xbd, 0xb1, 0x7f,
+  0x66, 0xf6, 0xae, 0x4c, 0xd0, 0xab, 0xb0, 0xe2, 0x79, 0x79, 0x2d, 0x50, 0xf1, 0x7b, 0xba, 0x2b,
+  0xb8, 0xfc, 0xdf, 0x84, 0x68, 0x97, 0x32, 0x78, 0xcc, 0xe0, 0xaa, 0x41, 0xbd, 0xcd, 0x03, 0x8b,
+  0x9b, 0x54, 0x84, 0x45, 0x5d, 0x67, 0xc5, 0xae, 0x7f, 0x5a, 0x94, 0xcf, 0xcd, 0xe2, 0x6b, 0x7b,
+  0xa6, 0xa8, 0x99, 0xde, 0x5f, 0x4b, 0xd9, 0x8b, 0x33, 0xf8, 0x5a, 0xe5, 0xd0, 0xee, 0xc1, 0x4f,
+  0x7d, 0x21, 0xd0, 0x93, 0x02, 0x88, 0x5e, 0x66, 0x55, 0xdb, 0xbd, 0xd7, 0x43, 0xec, 0xa5, 0xb8,
+  0xa1, 0xb4, 0xb5, 0x65, 0x6a, 0xd0, 0xb0, 0x8e, 0x43, 0xa3, 0x3d, 0x2a, 0xcf, 0x61, 0x94, 0x43,
+  0x55, 0x3a, 0xdb, 0x0c, 0x0e, 0x9b, 0x43, 0xc2, 0x96, 0x71, 0x71, 0x34, 0x86, 0x0a, 0x58, 0xf7,
+  0xe4, 0xb7, 0x7e, 0x7d, 0xf8, 0x4e, 0x42, 0x17, 0xac, 0x5a, 0xf3, 0xa7, 0xfd, 0x37, 0x3f, 0x5d,
+  0x0f, 0x34, 0xd0, 0x7a, 0x21, 0xad, 0x61, 0xd0, 0xeb, 0xeb, 0x37, 0xaf, 0x77, 0x18, 0x74, 0x37,
+  0xb7, 0x75, 0x13, 0x4d, 0x6f, 0xfe, 0xb3, 0x65, 0x51, 0x4d, 0x9e, 0xeb, 0x22, 0x67, 0x3f, 0xbd,
+  0xa6, 0xdb, 0x9c, 0x8f, 0xba, 0x59, 0x0f, 0x3b, 0xea, 0xaa, 0x36, 0x7b, 0x84, 0x4d, 0x6c, 0xd6,
+  0xde, 0x5a, 0x7c, 0x41, 0x4c, 0x8f, 0x26, 0xc9, 0xd8, 0x58, 0x35, 0x86, 0xc6, 0xba, 0xdd, 0x1d,
+  0xb9, 0xfd, 0x5d, 0x4d, 0x32, 0xcc, 0xac, 0x96, 0xad, 0xd7, 0x17, 0xf0, 0xad, 0x1a, 0x94, 0x1c,
+  0x4e, 0x85, 0x77, 0x30, 0xb9, 0x0b, 0x1f, 0x40, 0xa8, 0x35, 0xbe, 0x41, 0x61, 0x49, 0x09, 0x2a,
+  0x48, 0xec, 0x05, 0x44, 0x72, 0xa5, 0xac, 0xec, 0x19, 0xbe, 0xd9, 0x03, 0x17, 0xa6, 0x3b, 0x1c,
+  0x75, 0xd5, 0xcb, 0xed, 0xc5, 0xaa, 0x2e, 0x13, 0x6e, 0x8d, 0x8d, 0x44, 0xae, 0x2d, 0xc1, 0x28,
+  0x17, 0x86, 0x11, 0xd6, 0x1f, 0xb2, 0xa0, 0x5e, 0x0a, 0x1b, 0x8e, 0xd0, 0xb6, 0x8d, 0xc9, 0xed,
+  0xf5, 0xf5, 0xa8, 0xab, 0xde, 0xd7, 0x03, 0x82, 0xcd, 0xcd, 0xed, 0xe7, 0xdd, 0x20, 0x60, 0x1a,
+  0xc9, 0x4d, 0x41, 0xf2, 0x2e, 0x88, 0x9e, 0xb3, 0xc1, 0xe6, 0xe3, 0x41, 0xba, 0xbe, 0x94, 0xd9,
+  0x32, 0x60, 0x49, 0x42, 0x5e, 0x91, 0x2b, 0xdb, 0x06, 0x9a, 0xc9, 0x11, 0x54, 0x9e, 0x43, 0xdb,
+  0xec, 0xb7, 0xcf, 0x5b, 0x7b, 0xd4, 0xae, 0xd2, 0x95, 0x78, 0x8a, 0x40, 0x2d, 0x50, 0xdc, 0x1d,
+  0x66, 0x48, 0x13, 0xcc, 0x25, 0x06, 0x83, 0xf8, 0x3c, 0x18, 0x1b, 0x7d, 0x03, 0x37, 0x48, 0x63,
+  0xe3, 0xdc, 0x58, 0x2a, 0x70, 0x60, 0xec, 0x55, 0xcd, 0x41, 0x4c, 0x5f, 0x53, 0x8b, 0x65, 0x3a,
+  0xa8, 0xe7, 0x26, 0x36, 0x00, 0xfc, 0xd9, 0x9d, 0xe4, 0x30, 0xf3, 0x79, 0x2c, 0xb0, 0xc8, 0x2c,
+  0x62, 0x50, 0xe7, 0x0e, 0xb5, 0x1f, 0xa2, 0xf8, 0x35, 0x89, 0xac, 0x43, 0x4d, 0x78, 0x0c, 0xef,
+  0x9e, 0xca, 0xb6, 0xf0, 0x78, 0x99, 0xe4, 0xcb, 0xfb, 0x4b, 0x22, 0x71, 0xee, 0xd1, 0x47, 0x0e,
+  0xe7, 0xba, 0x28, 0xef, 0xf2, 0x92, 0xbc, 0xf2, 0x82, 0xd4, 0x9f, 0x43, 0x8e, 0x95, 0xda, 0x03,
+  0xc8, 0x5f, 0xe3, 0x4c, 0x73, 0xbd, 0x4c, 0x73, 0xa7, 0xe7, 0xa0, 0x3b, 0x28, 0xc6, 0x26, 0x73,
+  0x61, 0xeb, 0xc1, 0xe2, 0xb1, 0xf1, 0xe5, 0x10, 0xb4, 0x4e, 0x25, 0xda, 0xf7, 0x87, 0xa0, 0x9d,
+  0x57, 0xa2, 0xbd, 0x2c, 0xd3, 0x6b, 0x89, 0xb3, 0x1e, 0xc1, 0x7f, 0x95, 0xdd, 0x3f, 0x53, 0x9f,
+  0xd5, 0x0b, 0x64, 0x59, 0x27, 0xeb, 0x45, 0xb2, 0x31, 0x99, 0x29, 0x38, 0xaa, 0x36, 0x37, 0x5a,
+  0x11, 0x1d, 0x33, 0xcb, 0x98, 0x7c, 0x61, 0x96, 0x16, 0x90, 0x13, 0x33, 0x3c, 0x0b, 0x7b, 0x8f,
+  0x83, 0x16, 0xe0, 0x1c, 0xae, 0x06, 0xc4, 0x72, 0xca, 0xb4, 0xc0, 0xe4, 0x66, 0xcd, 0x98, 0xfc,
+  0x07, 0x07, 0x4d, 0x7a, 0xd0, 0x79, 0x20, 0x41, 0x18, 0x48, 0xf3, 0xd6, 0xb6, 0x5b, 0x5a, 0xe0,
+  0x4f, 0xcc, 0xf3, 0xd0, 0xa8, 0xbf, 0xc8, 0x51, 0x2f, 0x53, 0xaa, 0xc4, 0x33, 0xb9, 0x95, 0xa3,
+  0x16, 0x68, 0xc4, 0x03, 0xe0, 0xf9, 0x0e, 0xae, 0x7a, 0x60, 0x69, 0x1c, 0x79, 0x40, 0xf1, 0x4e,
+  0x8e, 0x5a, 0xa0, 0xe6, 0x13, 0x05, 0x73, 0x4e, 0xe1, 0xaa, 0x05, 0xe6, 0x53, 0x07, 0xb6, 0x64,
+  0xd4, 0x98, 0x7c, 0x52, 0x37, 0x5a, 0xc0, 0x1e, 0xf7, 0x81, 0xd9, 0x1b, 0xb8, 0x6a, 0xd2, 0x8c,
+  0x43, 0xac, 0x42, 0x9f, 0xe4, 0xa8, 0x67, 0x12, 0x8f, 0x2f, 0xd0, 0x22, 0x38, 0x68, 0x01, 0x06,
+  0x74, 0xf1, 0x64, 0x4c, 0x3e, 0xc3, 0x55, 0x0b, 0x4c, 0x30, 0xea, 0x19, 0x93, 0x7b, 0xb8, 0x6a,
+  0x81, 0x25, 0xdc, 0x5b, 0x60, 0x63, 0x3b, 0x93, 0xa3, 0x5e, 0x5c, 0x42, 0x5e, 0x83, 0xb0, 0x84,
+  0xab, 0x5e, 0x94, 0x40, 0xe6, 0x02, 0x95, 0x5e, 0xe2, 0xa0, 0xe7, 0x37, 0xe0, 0xe5, 0x20, 0xe2,
+  0x14, 0x07, 0x3d, 0x19, 0xa9, 0xe7, 0xa3, 0x15, 0x67, 0x72, 0xd4, 0xa3, 0x19, 0x73, 0x3f, 0x41,
+  0xd8, 0xa9, 0xba, 0xd1, 0x02, 0xc6, 0x5d, 0xb3, 0x13, 0x1a, 0x93, 0x8f, 0x72, 0xd4, 0x02, 0x5d,
+  0xf0, 0xd0, 0x63, 0xc2, 0x98, 0xfc, 0x5b, 0x8e, 0x7a, 0x8e, 0x90, 0xc6, 0xbf, 0xa5, 0x21, 0x4f,
+  0xc0, 0xf9, 0xee, 0x97, 0xb7, 0x5a, 0x08, 0xbe, 0xb9, 0xf4, 0x1b, 0x37, 0x26, 0xff, 0xc4, 0x41,
+  0x2f, 0x27, 0x78, 0xa9, 0x0f, 0x19, 0x01, 0xae, 0x9a, 0xc9, 0xcb, 0x74, 0xb9, 0x85, 0xc9, 0x0b,
+  0x47, 0x3d, 0x59, 0x31, 0x93, 0xdc, 0x6b, 0x26, 0x12, 0x37, 0x14, 0x2a, 0xe9, 0x7d, 0x08, 0x05,
+  0xd1, 0x4e, 0x7c, 0x76, 0x18, 0xb3, 0x44, 0x64, 0x35, 0xe9, 0x5a, 0x3e, 0x90, 0x8a, 0xd2, 0xf4,
+  0xe3, 0xfa, 0x54, 0x55, 0xe7, 0xef, 0x28, 0xf8, 0x88, 0xa8, 0x59, 0xea, 0x23, 0xb5, 0x58, 0xbb,
+  0xd8, 0x67, 0x70, 0x7a, 0xe5, 0x1e, 0x76, 0xcd, 0x73, 0xe4, 0xff, 0x8b, 0xba, 0xd1, 0xf3, 0x26,
+  0x1a, 0x0b, 0x48, 0x84, 0x77, 0x38, 0xe8, 0xf9, 0x93, 0xc9, 0xd0, 0x2d, 0x6e, 0x71, 0xd0, 0x73,
+  0x0c, 0x46, 0x21, 0xe4, 0x3e, 0xc0, 0x55, 0x2f, 0x47, 0xb8, 0x31, 0x4f, 0x84, 0x4f, 0xa1, 0xc9,
+  0x9d, 0x2e, 0x6f, 0xf5, 0xe8, 0x52, 0x2c, 0xf8, 0xd2, 0xa1, 0x3e, 0x2c, 0x6f, 0x35, 0x2b, 0x2a,
+  0xb4, 0xa2, 0x51, 0x8a, 0x3e, 0x3d, 0x5d, 0xde, 0x6a, 0x1a, 0x2a, 0xb0, 0x42, 0x1f, 0xed, 0x84,
+  0xe3, 0x9f, 0x60, 0x5b, 0x3e, 0x95, 0x47, 0x3e, 0x69, 0x4c, 0x91, 0x8f, 0x23, 0x6c, 0x5c, 0x66,
+  0x74, 0xc1, 0xba, 0x37, 0x78, 0xca, 0x35, 0x03, 0x2f, 0xe6, 0x81, 0x93, 0xd4, 0xdb, 0xc1, 0x6c,
+  0x1e, 0x3d, 0xed, 0x0a, 0x9a, 0xec, 0x70, 0x2f, 0x83, 0xc1, 0x53, 0x2f, 0x83, 0x84, 0x81, 0xe9,
+  0x71, 0xf3, 0x9b, 0x7a, 0x54, 0xe2, 0x34, 0x5b, 0x86, 0x64, 0x84, 0xa8, 0xc7, 0x51, 0x57, 0xc1,
+  0xd5, 0x42, 0x8a, 0xa7, 0x5d, 0x39, 0xa4, 0xf8, 0xb8, 0x46, 0x2a, 0x05, 0xab, 0x42, 0x5a, 0xbd,
+  0xd5, 0xa8, 0x63, 0x38, 0x75, 0x20, 0x5c, 0x62, 0xb1, 0x99, 0x9c, 0xd8, 0x6f, 0xaa, 0xdc, 0x91,
+  0xb2, 0xb1, 0x5f, 0xef, 0xa5, 0x87, 0xcf, 0x6a, 0xb3, 0x25, 0xa7, 0xd6, 0xef, 0x26, 0x25, 0x72,
+  0xa9, 0x9c, 0x17, 0xd1, 0x60, 0x0d, 0x90, 0xe1, 0xc2, 0xcf, 0xa0, 0xd0, 0xce, 0xfd, 0xeb, 0xfe,
+  0x7e, 0x48, 0xde, 0xf1, 0x64, 0x75, 0x9a, 0x0d, 0x8e, 0x0d, 0xcb, 0xeb, 0x25, 0x68, 0x79, 0x40,
+  0xa6, 0xd0, 0x65, 0x9f, 0xd8, 0x95, 0x05, 0xc0, 0xab, 0x88, 0x7a, 0xdf, 0xe9, 0x74, 0x76, 0xab,
+  0x36, 0xbb, 0xcd, 0x3e, 0xa2, 0x43, 0x83, 0x11, 0xe5, 0xc2, 0xa9, 0xdb, 0x25, 0xef, 0x99, 0xc8,
+  0xd0, 0x10, 0x3b, 0x0e, 0x7d, 0x22, 0x5c, 0x46, 0xae, 0x66, 0x77, 0x83, 0xd3, 0xd5, 0x22, 0x3b,
+  0x0d, 0x4c, 0x19, 0xbd, 0x0e, 0x13, 0x4a, 0xed, 0xcd, 0x56, 0xf1, 0x64, 0x99, 0x09, 0xd3, 0x6d,
+  0x36, 0xba, 0x0a, 0x51, 0xa3, 0xb5, 0xa5, 0x9e, 0x0e, 0xa0, 0x0d, 0x9a, 0x50, 0xbd, 0x22, 0xf0,
+  0x6b, 0x46, 0xc6, 0x13, 0xb2, 0xbc, 0xef, 0xfc, 0x17, 0xfa, 0x9c, 0x66, 0x6b, 0x17, 0x88, 0x45,
+  0x05, 0xc5, 0xe5, 0xbf, 0x97, 0x7a, 0x6d, 0x1a, 0xc1, 0x3c, 0xfb, 0xfa, 0x51, 0x2e, 0x6b, 0x5d,
+  0x94, 0xae, 0xb1, 0x42, 0x33, 0xf5, 0x41, 0x6b, 0x1d, 0x60, 0xff, 0xca, 0x63, 0x78, 0x7b, 0xf9,
+  0xf4, 0xd1, 0x6a, 0x36, 0x36, 0x95, 0xda, 0x68, 0x75, 0xd0, 0x5a, 0x53, 0xf5, 0x44, 0xc6, 0xe4,
+  0x1f, 0xb3, 0xdb, 0xcf, 0x9d, 0x44, 0xc4, 0xa0, 0x67, 0x6e, 0x3f, 0x49, 0x0a, 0x27, 0x24, 0x48,
+  0x3d, 0xef, 0x84, 0x9c, 0x96, 0x90, 0xfa, 0x5e, 0x22, 0x01, 0xb8, 0x0c, 0xa8, 0x85, 0xc5, 0x31,
+  0x54, 0xcd, 0x9d, 0x32, 0x00, 0xfd, 0x04, 0xba, 0xae, 0x8e, 0x5c, 0xd6, 0x6c, 0x5c, 0xc9, 0xd5,
+  0x8e, 0x4a, 0x1b, 0x99, 0x65, 0x86, 0x8d, 0x13, 0x22, 0xa7, 0x8f, 0x2c, 0x62, 0x29, 0xb1, 0x46,
+  0x99, 0x6c, 0x65, 0x07, 0xe5, 0x79, 0x2f, 0xfa, 0x2a, 0x0d, 0x41, 0xbe, 0x7e, 0x24, 0x0f, 0x5c,
+  0xb8, 0xf8, 0x4d, 0x31, 0x46, 0x12, 0x0a, 0xe3, 0xb6, 0x27, 0x6d, 0xda, 0xad, 0xa0, 0x98, 0x35,
+  0xba, 0x48, 0x9e, 0x24, 0xab, 0xd3, 0xe1, 0x17, 0xf5, 0x04, 0x96, 0x6b, 0x41, 0x50, 0x59, 0x69,
+  0x40, 0x44, 0x24, 0xd0, 0x51, 0x6f, 0xc9, 0x1f, 0x7f, 0x90, 0x46, 0x68, 0xdb, 0x05, 0x01, 0x77,
+  0xd0, 0x9e, 0xaf, 0x8e, 0x54, 0xeb, 0x51, 0x56, 0xeb, 0x8b, 0x94, 0xd5, 0x5b, 0xa4, 0x3c, 0xa8,
+  0x45, 0x15, 0x8f, 0x38, 0xeb, 0xd1, 0xc3, 0x95, 0x45, 0x6a, 0xf8, 0x4e, 0x53, 0x4a, 0x79, 0xf2,
+  0x98, 0xe0, 0xc9, 0x63, 0x4d, 0x31, 0x97, 0xe7, 0x8c, 0x5b, 0x92, 0x2e, 0x27, 0xea, 0x0b, 0x8b,
+  0xc7, 0x7b, 0xdc, 0x26, 0x74, 0x41, 0x39, 0xd4, 0x46, 0x6f, 0x53, 0x70, 0x98, 0x90, 0xde, 0x81,
+  0x9f, 0xda, 0x5a, 0x25, 0xa1, 0xb3, 0x93, 0x43, 0x79, 0x96, 0x57, 0xe4, 0x0e, 0x5e, 0x76, 0x62,
+  0xe4, 0xac, 0x77, 0xa1, 0x87, 0xc9, 0x29, 0xc3, 0xe4, 0x1c, 0x82, 0x69, 0x5e, 0x86, 0x69, 0x5e,
+  0x82, 0xe9, 0x7b, 0x1d, 0xdd, 0x61, 0x4d, 0x29, 0x86, 0xd7, 0x86, 0xda, 0xb0, 0x0c, 0x91, 0x57,
+  0xaf, 0xc8, 0xea, 0x61, 0xfd, 0x2d, 0x55, 0x4b, 0x9d, 0x9b, 0xf5, 0x0f, 0x64, 0x90, 0x25, 0xf3,
+  0x06, 0xfa, 0xce, 0x0e, 0xb5, 0x60, 0x7e, 0x85, 0xb5, 0xd1, 0xba, 0xd0, 0xc4, 0x9a, 0x2b, 0x92,
+  0xdb, 0xa9, 0x49, 0x15, 0xcd, 0xe9, 0xea, 0xfb, 0xaf, 0x08, 0x49, 0x83, 0xfc, 0x2d, 0x27, 0x5c,
+  0x27, 0x61, 0x31, 0x7e, 0x8d, 0x43, 0x7f, 0x87, 0x06, 0x34, 0x80, 0xfd, 0x7d, 0x91, 0x85, 0xef,
+  0x84, 0x79, 0x09, 0x3b, 0x92, 0xb4, 0x31, 0xf3, 0xc3, 0x05, 0xfb, 0xd1, 0x02, 0xe7, 0xbb, 0x84,
+  0xc6, 0x2e, 0xbf, 0x28, 0xcf, 0xc1, 0x33, 0x0c, 0xe5, 0xac, 0x3d, 0x85, 0xd1, 0xf7, 0xa1, 0xbb,
+  0xde, 0x4e, 0xbd, 0x09, 0xac, 0xca, 0x4e, 0xe8, 0x9b, 0xb0, 0xe7, 0xa1, 0x7e, 0x52, 0x74, 0x07,
+  0xd8, 0x78, 0x91, 0x34, 0xf6, 0x90, 0xa7, 0x6e, 0x86, 0xee, 0xef, 0xa8, 0x7a, 0xb5, 0xfa, 0xa2,
+  0xa4, 0xf0, 0xc3, 0x6a, 0xad, 0x92, 0x8f, 0x92, 0x1f, 0x5a, 0xf2, 0x97, 0xe5, 0xd2, 0x0b, 0x9d,
+  0x66, 0x23, 0x13, 0x64, 0x85, 0x19, 0x0b, 0xe5, 0x9e, 0x56, 0x00, 0x94, 0xf4, 0x85, 0xd9, 0xb0,
+  0xd8, 0x5d, 0xb6, 0x3c, 0xd4, 0x16, 0xe0, 0x42, 0x94, 0x24, 0x6e, 0x18, 0x0b, 0x62, 0x31, 0x8f,
+  0x3e, 0x95, 0x42, 0x26, 0x4c, 0xdc, 0x73, 0x9f, 0x85, 0xa9, 0x68, 0xae, 0xba, 0xa0, 0x13, 0x72,
+  0xde, 0xeb, 0xfd, 0xf0, 0x4e, 0x00, 0xed, 0x85, 0xc5, 0x39, 0xb3, 0xc4, 0xbe, 0x56, 0xa0, 0xba,
+  0x4c, 0xcb, 0xed, 0x80, 0x99, 0xdf, 0xec, 0x94, 0x38, 0x48, 0x6e, 0x03, 0x51, 0x60, 0x34, 0xef,
+  0x3b, 0x0d, 0x85, 0x66, 0x8c, 0xcb, 0x1b, 0x95, 0x84, 0xe5, 0x96, 0xa1, 0x82, 0x70, 0x7e, 0x93,
+  0x51, 0x83, 0x30, 0x2e, 0xaf, 0x26, 0x3c, 0x43, 0x67, 0x8e, 0x08, 0x5b, 0x60, 0x94, 0x79, 0x10,
+  0xc7, 0x2c, 0x60, 0xf1, 0x3a, 0x65, 0xae, 0xe2, 0x15, 0x72, 0xd9, 0x15, 0xae, 0xb9, 0xc9, 0x96,
+  0x34, 0x1b, 0xef, 0x6e, 0x3f, 0x65, 0xd1, 0x89, 0xcc, 0x43, 0x34, 0x9e, 0xac, 0x58, 0x6d, 0x96,
+  0xb4, 0x2c, 0xd8, 0x47, 0x67, 0x7f, 0xe5, 0x5a, 0x96, 0x97, 0x73, 0xbd, 0xf3, 0xfe, 0xda, 0x98,
+  0x31, 0x1c, 0xb1, 0x98, 0x87, 0x90, 0x86, 0x96, 0x8e, 0xaa, 0x3a, 0xa6, 0xa4, 0xa0, 0x15, 0xf1,
+  0x11, 0xff, 0x6a, 0x08, 0xaa, 0x4a, 0xc1, 0x2b, 0x7b, 0x15, 0x44, 0xee, 0x0e, 0x6f, 0xac, 0xb6,
+  0x15, 0x65, 0xba, 0xf8, 0x15, 0x60, 0x9f, 0x7a, 0xb6, 0x4c, 0xa8, 0xb0, 0x8d, 0x31, 0xab, 0x08,
+  0x97, 0x27, 0xaa, 0x2e, 0x16, 0x93, 0x77, 0x85, 0x0c, 0x97, 0x87, 0x36, 0x68, 0xdb, 0x12, 0xc8,
+  0x0f, 0x6d, 0x5a, 0x02, 0x28, 0x64, 0xcf, 0x13, 0xe0, 0x5a, 0xb7, 0xd7, 0x3b, 0x8a, 0xea, 0x11,
+  0xd7, 0x33, 0x15, 0xff, 0x9c, 0x9e, 0xf1, 0x28, 0xca, 0x5f, 0xe2, 0x7b, 0x9e, 0x1c, 0xb2, 0xfd,
+  0x94, 0x9f, 0x8b, 0x37, 0x4b, 0xda, 0xe6, 0x26, 0x05, 0x56, 0x95, 0x72, 0x84, 0xc9, 0x5a, 0x90,
+  0x18, 0x9b, 0xb9, 0x7a, 0x9d, 0x68, 0x79, 0xcb, 0xa8, 0xd0, 0x38, 0x55, 0x68, 0x9c, 0x5a, 0x68,
+  0xe6, 0x55, 0x68, 0xe6, 0x15, 0x68, 0x36, 0xd4, 0x0c, 0x00, 0x52, 0xc1, 0x31, 0xfc, 0x6b, 0x9c,
+  0xe0, 0x9d, 0xb3, 0xba, 0x9b, 0xb7, 0x6a, 0xf7, 0xac, 0x95, 0xea, 0xd9, 0xed, 0x12, 0x2b, 0x0b,
+  0x14, 0xa8, 0x55, 0xaa, 0xea, 0xc8, 0x28, 0xe7, 0x07, 0xa1, 0x2c, 0xfa, 0x9b, 0x3a, 0x3d, 0x57,
+  0x27, 0x9a, 0xf9, 0x02, 0xb8, 0x97, 0xbc, 0xfc, 0xe8, 0xfd, 0x8c, 0xd8, 0xc7, 0xfd, 0x40, 0x2e,
+  0x42, 0x76, 0x74, 0x1e, 0x85, 0xfa, 0x0a, 0x24, 0xf7, 0x87, 0xd6, 0xb6, 0xc9, 0xab, 0x82, 0x2d,
+  0xfb, 0x68, 0xa0, 0x2b, 0x7e, 0xf6, 0x19, 0xe0, 0xff, 0xab, 0x80, 0x8c, 0xe8, 0x73, 0x54, 0xb0,
+  0xbc, 0x1f, 0x75, 0x97, 0x47, 0x6e, 0xa3, 0xae, 0xfa, 0x6b, 0xbf, 0x51, 0x57, 0xfd, 0xdf, 0x9b,
+  0xff, 0x01, 0x12, 0x13, 0x5f, 0x7d, 0x8c, 0x33, 0x00, 0x00,
+};
+
+const LumiAsset webpage_html = {
+  webpage_html_gz,
+  sizeof(webpage_html_gz),
+  "text/html",
+  "\"e08a0d333cb3746d\""
+};
+
+#endif // WEBPAGE_HTML_H
@@ -18,18 +18,19 @@
  * 5. Open the Serial Monitor to see the connection details
  * 6. Connect to the IP address shown in the Serial Monitor using a web browser
  * 
- * MQTT Control Commands:
- * - switch:on/off    - Turn LED strip ON/OFF
- * - bright:1-5       - Set brightness level (1=lowest, 5=highest)
- * - fade:on/off      - Enable/disable fade-in effects
- * - rgb:255,128,64   - Set solid RGB color (R,G,B values)
- * - color:red        - Set solid color using color names
- * - palette:rainbow  - Set color palette (rainbow, party, ocean, etc.)
- * - blend_spd:1-5    - Set palette blending speed
- * - power:5,1000     - Set max power (volts,milliamps)
- * - config:save      - Save current settings to EEPROM
- * - config:load      - Load settings from EEPROM
- * - status           - Request immediate status report
+ * MQTT Control Commands (JSON objects, several fields may be combined,
+ * e.g. {"bright":3,"palette":"ocean"}):
+ * - {"switch":"on"}           - Turn LED strip ON/OFF ("on"/"off" or true/false)
+ * - {"bright":3}              - Set brightness level 1-5 (1=lowest, 5=highest)
+ * - {"fade":"on"}             - Enable/disable fade-in effects
+ * - {"rgb":[255,128,64]}      - Set solid RGB color [R,G,B]
+ * - {"color":"red"}           - Set solid color using color names
+ * - {"palette":"rainbow"}     - Set color palette (rainbow, party, ocean, etc.)
+ * - {"blend_spd":3}           - Set palette blending speed 1-5
+ * - {"power":[5,1000]}        - Set max power [volts,milliamps]
+ * - {"config":"save"}         - Save current settings to EEPROM
+ * - {"config":"load"}         - Load settings from EEPROM
+ * - {}                        - Request immediate status report
  * 
  * Web Dashboard Features:
  * - Power switch to turn LED strip ON/OFF
@@ -236,24 +237,23 @@ void reconnectMqtt() {
 // MQTT MESSAGE CALLBACK
 // ================================
 void onMqttMessage(char* topic, byte* payload, unsigned int length) {
-  String message = "";
-  for (int i = 0; i < length; i++) {
-    message += (char)payload[i];
-  }
-  
   Serial.print("MQTT message received: ");
-  Serial.println(message);
+  Serial.write(payload, length);
+  Serial.println();
   
-  // Process the command
-  bool commandProcessed = processCommand(message);
+  // Parsed in place by the library - the payload is never copied into a String
+  LumiCommandResult result = ledController.applyCommand((const char*)payload, length);
   
-  if (commandProcessed) {
-    // Send status update after successful command
+  if (result.error == LUMI_CMD_OK) {
+    // Send status update after successful command ({} only requests the status)
     sendStatus();
   } else {
     // Send error message
-    String errorMsg = "Error: Unknown command '" + message + "'";
-    mqttClient.publish(led_status_topic, errorMsg.c_str());
+    char errorMsg[96];
+    snprintf(errorMsg, sizeof(errorMsg), "Error: %s '%.*s' at offset %u",
+        AvantLumi::commandErrorText(result.error), result.fieldLength,
+        result.field ? result.field : "", (unsigned)result.offset);
+    mqttClient.publish(led_status_topic, errorMsg);
   }
 }
 
@@ -270,6 +270,9 @@ void setupWebServer() {
   // Handle status requests
   server.on("/status", HTTP_GET, handleStatus);
   
+  // Needed so handleRoot() can answer 304 for a cached page
+  lumiCollectAssetHeaders(server);
+  
   // Start the server
   server.begin();
   Serial.println("HTTP server started");
@@ -279,7 +282,8 @@ void setupWebServer() {
 // WEB PAGE HANDLER
 // ================================
 void handleRoot() {
-  server.send_P(200, "text/html", webpage_html);
+  // Gzip-compressed page from webpage.h (regenerate with tools/embed_asset.py)
+  lumiSendAsset(server, webpage_html);
 }
 
 // ================================
@@ -392,102 +396,18 @@ void handleStatus() {
   server.send(200, "application/json", statusJson);
 }
 
-// ================================
-// COMMAND PROCESSING
-// ================================
-bool processCommand(String command) {
-  command.trim();
-  command.toLowerCase();
-  
-  // Parse command and value
-  int colonIndex = command.indexOf(':');
-  if (colonIndex == -1 && command != "status") {
-    return false;
-  }
-  
-  String cmd, value;
-  if (colonIndex != -1) {
-    cmd = command.substring(0, colonIndex);
-    value = command.substring(colonIndex + 1);
-    cmd.trim();
-    value.trim();
-  } else {
-    cmd = command;
-  }
-  
-  // Process commands
-  if (cmd == "switch") {
-    return ledController.setSwitch(value);
-  }
-  else if (cmd == "bright") {
-    uint8_t level = value.toInt();
-    return ledController.setBright(level);
-  }
-  else if (cmd == "fade") {
-    return ledController.setFade(value);
-  }
-  else if (cmd == "rgb") {
-    // Parse RGB values: "255,128,64"
-    int comma1 = value.indexOf(',');
-    int comma2 = value.indexOf(',', comma1 + 1);
-    
-    if (comma1 != -1 && comma2 != -1) {
-      uint8_t r = value.substring(0, comma1).toInt();
-      uint8_t g = value.substring(comma1 + 1, comma2).toInt();
-      uint8_t b = value.substring(comma2 + 1).toInt();
-      return ledController.setRGB(r, g, b);
-    }
-    return false;
-  }
-  else if (cmd == "color") {
-    return ledController.setColor(value);
-  }
-  else if (cmd == "palette") {
-    return ledController.setPalette(value);
-  }
-  else if (cmd == "blend_spd") {
-    uint8_t speed = value.toInt();
-    return ledController.setBlendSpeed(speed);
-  }
-  else if (cmd == "power") {
-    // Parse power values: "5,1000" (volts,milliamps)
-    int commaIndex = value.indexOf(',');
-    if (commaIndex != -1) {
-      uint8_t volts = value.substring(0, commaIndex).toInt();
-      uint32_t milliamps = value.substring(commaIndex + 1).toInt();
-      return ledController.setMaxPower(volts, milliamps);
-    }
-    return false;
-  }
-  else if (cmd == "config" && value == "save") {
-    bool success = ledController.saveConfig();
-    String msg = success ? "Configuration saved to EEPROM" : "Failed to save configuration";
-    mqttClient.publish(led_status_topic, msg.c_str());
-    return success;
-  }
-  else if (cmd == "config" && value == "load") {
-    bool success = ledController.loadConfig();
-    String msg = success ? "Configuration loaded from EEPROM" : "Failed to load configuration";
-    mqttClient.publish(led_status_topic, msg.c_str());
-    return success;
-  }
-  else if (cmd == "status") {
-    // Status will be sent by the calling function
-    return true;
-  }
-  
-  return false;
-}
-
 // ================================
 // STATUS REPORTING
 // ================================
 void sendStatus() {
   if (mqttClient.connected()) {
-    String statusJson = ledController.getStatus();
+    // State only: the full getStatus() text with memory and latency figures
+    // is longer than PubSubClient's default 256-byte packet
+    const char* statusJson = ledController.getStatusJson();
     
-    if (mqttClient.publish(led_status_topic, statusJson.c_str(), true)) {
-      Serial.println("Status sent: " + statusJson);
+    if (mqttClient.publish(led_status_topic, statusJson, true)) {
+      Serial.print("Status sent: ");
+      Serial.println(statusJson);
     } else {
       Serial.println("Failed to publish status!");
     }
@@ -550,37 +470,37 @@ String getEnhancedStatus() {
  * MQTT Command Examples:
  * 
  * Basic Control:
- * - switch:on          - Turn LED strip on
- * - switch:off         - Turn LED strip off
- * - bright:3           - Set brightness to level 3 (1-5)
- * - fade:on            - Enable fade effects
- * - fade:off           - Disable fade effects
+ * - {"switch":"on"}           - Turn LED strip on
+ * - {"switch":"off"}          - Turn LED strip off
+ * - {"bright":3}              - Set brightness to level 3 (1-5)
+ * - {"fade":"on"}             - Enable fade effects
+ * - {"fade":"off"}            - Disable fade effects
  * 
  * Color Control:
- * - rgb:255,0,0        - Set solid red color
- * - rgb:128,255,64     - Set custom RGB color
- * - color:blue         - Set solid blue using color name
- * - color:hotpink      - Set solid hot pink
- * - color:forestgreen  - Set solid forest green
+ * - {"rgb":[255,0,0]}         - Set solid red color
+ * - {"rgb":[128,255,64]}      - Set custom RGB color
+ * - {"color":"blue"}          - Set solid blue using color name
+ * - {"color":"hotpink"}       - Set solid hot pink
+ * - {"color":"forestgreen"}   - Set solid forest green
  * 
  * Palette Control:
- * - palette:rainbow    - Rainbow colors
- * - palette:party      - Party colors
- * - palette:ocean      - Ocean colors
- * - palette:heat       - Heat colors
- * - palette:christmas  - Christmas theme (red/green)
- * - palette:halloween  - Halloween theme (orange/purple)
- * - palette:cyberpunk  - Cyberpunk theme (pink/cyan)
- * - palette:random     - Random palette generation
+ * - {"palette":"rainbow"}     - Rainbow colors
+ * - {"palette":"party"}       - Party colors
+ * - {"palette":"ocean"}       - Ocean colors
+ * - {"palette":"heat"}        - Heat colors
+ * - {"palette":"christmas"}   - Christmas theme (red/green)
+ * - {"palette":"halloween"}   - Halloween theme (orange/purple)
+ * - {"palette":"cyberpunk"}   - Cyberpunk theme (pink/cyan)
+ * - {"palette":"random"}      - Random palette generation
  * 
  * Advanced Settings:
- * - blend_spd:3        - Set blending speed (1=slow, 5=fast)
- * - power:5,1000       - Set max power to 5V, 1000mA
+ * - {"blend_spd":3}           - Set blending speed (1=slow, 5=fast)
+ * - {"power":[5,1000]}        - Set max power to 5V, 1000mA
  * 
  * Configuration:
- * - config:save        - Save current settings to EEPROM
- * - config:load        - Load settings from EEPROM
- * - status             - Get immediate status report
+ * - {"config":"save"}         - Save current settings to EEPROM
+ * - {"config":"load"}         - Load settings from EEPROM
+ * - {}                        - Get immediate status report
  * 
  * Web Control Examples (sent via HTTP GET requests):
  * 
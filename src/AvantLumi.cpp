@@ -11,10 +11,62 @@
  */
 
 #include "AvantLumi.h"
+#include "LumiAudio.h"
+#include "LumiMemory.h"
+#include <stdarg.h>
+
+#ifdef LUMI_HOST_MALLINFO
+#include <malloc.h>
+#endif
+
+#ifdef AVANTLUMI_PROFILE
+#define LUMI_PROFILE_BEGIN() uint32_t lumiStageStart = profileNow()
+#define LUMI_PROFILE_STAGE(stage) do { \
+        uint32_t lumiStageEnd = profileNow(); \
+        recordStage(stage, lumiStageEnd - lumiStageStart); \
+        lumiStageStart = lumiStageEnd; \
+    } while (0)
+#else
+#define LUMI_PROFILE_BEGIN() ((void)0)
+#define LUMI_PROFILE_STAGE(stage) ((void)0)
+#endif
 
 // Static member definitions
 const uint8_t AvantLumi::brightnessLevels[6] = {0, 26, 64, 128, 192, 255};
 
+// Coalesced command fields (pendingFields bits)
+const uint8_t CMD_LOOK   = 0x01;   // setRGB / setColor / setPalette share one slot
+const uint8_t CMD_BRIGHT = 0x02;
+const uint8_t CMD_SWITCH = 0x04;
+const uint8_t CMD_FADE   = 0x08;
+const uint8_t CMD_BLEND  = 0x10;
+
+const uint8_t LOOK_RGB     = 0;
+const uint8_t LOOK_COLOR   = 1;
+const uint8_t LOOK_PALETTE = 2;
+
+// Starting state of the fade-speed sequence, see lumiFadeDivisor()
+#define FADE_SEED 535
+
+// Clock used for show time until setSyncClock() replaces it
+static uint32_t defaultMillis() {
+    return millis();
+}
+
+// Appends to a fixed status buffer; output that does not fit is cut off
+static void appendStatus(char* buffer, size_t size, uint16_t& length, const char* format, ...) {
+    if ((size_t)length + 1 >= size) {
+        return;
+    }
+    va_list args;
+    va_start(args, format);
+    int written = vsnprintf(buffer + length, size - length, format, args);
+    va_end(args);
+    if (written > 0) {
+        length = (uint16_t)min((size_t)(length + written), size - 1);
+    }
+}
+
 // Custom palette definitions
 const CRGBPalette16 AvantLumi::christmas_p = CRGBPalette16(
     CRGB::Red, CRGB::DarkRed, CRGB::Green, CRGB::DarkGreen,
@@ -76,11 +128,180 @@ const CRGBPalette16 AvantLumi::fire_p = CRGBPalette16(
     CRGB::Red, CRGB::Coral, CRGB::Gold, CRGB::Maroon,
     CRGB::Tomato, CRGB::Orange, CRGB::Red, CRGB::DarkRed);
 
-// Constructor
+// Named colors accepted by setColor(); the index is the color id
+struct LumiNamedColor {
+    const char* name;
+    uint32_t rgb;
+};
+
+static const LumiNamedColor namedColors[] = {
+    // Basic colors
+    {"red", CRGB::Red},
+    {"green", CRGB::Green},
+    {"blue", CRGB::Blue},
+    {"white", CRGB::White},
+    {"black", CRGB::Black},
+    {"yellow", CRGB::Yellow},
+    {"cyan", CRGB::Cyan},
+    {"magenta", CRGB::Magenta},
+    {"orange", CRGB::Orange},
+    {"purple", CRGB::Purple},
+    {"pink", CRGB::Pink},
+    {"brown", CRGB::Brown},
+
+    // Extended colors - Light variations
+    {"lightgreen", CRGB::LightGreen},
+    {"lightblue", CRGB::LightBlue},
+    {"lightpink", CRGB::LightPink},
+    {"lightcyan", CRGB::LightCyan},
+    {"lightyellow", CRGB::LightYellow},
+    {"lightsteelblue", CRGB::LightSteelBlue},
+
+    // Extended colors - Dark variations
+    {"darkred", CRGB::DarkRed},
+    {"darkgreen", CRGB::DarkGreen},
+    {"darkblue", CRGB::DarkBlue},
+    {"darkorange", CRGB::DarkOrange},
+    {"darkviolet", CRGB::DarkViolet},
+    {"darkgray", CRGB::DarkGray},
+    {"darkgrey", CRGB::DarkGray},
+    {"darkcyan", CRGB::DarkCyan},
+    {"darkgoldenrod", CRGB::DarkGoldenrod},
+    {"darkslateblue", CRGB::DarkSlateBlue},
+    {"darkturquoise", CRGB::DarkTurquoise},
+    {"darkseagreen", CRGB::DarkSeaGreen},
+
+    // Extended colors - Medium variations
+    {"mediumblue", CRGB::MediumBlue},
+    {"mediumorchid", CRGB::MediumOrchid},
+    {"mediumspringgreen", CRGB::MediumSpringGreen},
+
+    // Special colors
+    {"springgreen", CRGB::SpringGreen},
+    {"forestgreen", CRGB::ForestGreen},
+    {"seagreen", CRGB::SeaGreen},
+    {"limegreen", CRGB::LimeGreen},
+    {"lime", CRGB::Lime},
+    {"aqua", CRGB::Aqua},
+    {"aquamarine", CRGB::Aquamarine},
+    {"turquoise", CRGB::Turquoise},
+    {"palegreen", CRGB::PaleGreen},
+    {"paleturquoise", CRGB::PaleTurquoise},
+    {"powderblue", CRGB::PowderBlue},
+    {"steelblue", CRGB::SteelBlue},
+    {"royalblue", CRGB::RoyalBlue},
+    {"cornflowerblue", CRGB::CornflowerBlue},
+    {"deepskyblue", CRGB::DeepSkyBlue},
+    {"dodgerblue", CRGB::DodgerBlue},
+    {"midnightblue", CRGB::MidnightBlue},
+    {"navy", CRGB::Navy},
+    {"indigo", CRGB::Indigo},
+    {"violet", CRGB::Violet},
+    {"fuchsia", CRGB::Fuchsia},
+    {"hotpink", CRGB::HotPink},
+    {"deeppink", CRGB::DeepPink},
+    {"crimson", CRGB::Crimson},
+    {"firebrick", CRGB::FireBrick},
+    {"maroon", CRGB::Maroon},
+    {"orangered", CRGB::OrangeRed},
+    {"tomato", CRGB::Tomato},
+    {"coral", CRGB::Coral},
+    {"chocolate", CRGB::Chocolate},
+    {"saddlebrown", CRGB::SaddleBrown},
+    {"sienna", CRGB::Sienna},
+    {"peru", CRGB::Peru},
+    {"goldenrod", CRGB::Goldenrod},
+    {"gold", CRGB::Gold},
+    {"greenyellow", CRGB::GreenYellow},
+    {"lemonchiffon", CRGB::LemonChiffon},
+    {"honeydew", CRGB::Honeydew},
+    {"lavender", CRGB::Lavender},
+    {"thistle", CRGB::Thistle},
+    {"aliceblue", CRGB::AliceBlue},
+    {"gray", CRGB::Gray},
+    {"grey", CRGB::Gray},
+    {"silver", CRGB::Silver},
+    {"teal", CRGB::Teal},
+    {"cadetblue", CRGB::CadetBlue},
+    {"darkslategray", CRGB::DarkSlateGray},
+    {"darkslategrey", CRGB::DarkSlateGray},
+    {"indianred", CRGB::IndianRed},
+};
+
+static const uint8_t NAMED_COLOR_COUNT = sizeof(namedColors) / sizeof(namedColors[0]);
+
+// Palette names accepted by setPalette(), indexed by LumiPaletteId
+struct LumiPaletteInfo {
+    const char* name;
+    const char* alias;       // Short "uNN" form, if any
+    const char* statusName;  // Name reported by getPalette()/getStatusText()
+};
+
+static const LumiPaletteInfo paletteInfo[LUMI_PALETTE_COUNT] = {
+    {"rainbow",    nullptr, "rainbow"},
+    {"party",      nullptr, "party"},
+    {"ocean",      nullptr, "ocean"},
+    {"forest",     nullptr, "forest"},
+    {"heat",       nullptr, "heat"},
+    {"cloud",      nullptr, "cloud"},
+    {"lava",       nullptr, "lava"},
+    {"christmas",  "u01",   "u01_christmas"},
+    {"autumn",     "u02",   "u02_autumn"},
+    {"cyberpunk",  "u03",   "u03_cyberpunk"},
+    {"halloween",  "u04",   "u04_halloween"},
+    {"winter",     "u05",   "u05_winter"},
+    {"spring",     "u06",   "u06_spring"},
+    {"sunset",     "u07",   "u07_sunset"},
+    {"deep_ocean", "u08",   "u08_deep_ocean"},
+    {"neon",       "u09",   "u09_neon"},
+    {"fire",       "u10",   "u10_fire"},
+    {"random",     nullptr, "random"}
+};
+
+// Constructors
 AvantLumi::AvantLumi(uint8_t dataPin, uint16_t numLeds) {
     this->dataPin = dataPin;
     this->numLeds = numLeds;
-    this->leds = new CRGB[numLeds];
+    this->bufferType = LUMI_BUFFER_INTERNAL;
+    this->ownsBuffer = true;
+    this->leds = allocateBuffer(numLeds);
+    initDefaults();
+}
+
+AvantLumi::AvantLumi(uint8_t dataPin, uint16_t numLeds, LumiBufferType bufferType) {
+    this->dataPin = dataPin;
+    this->numLeds = numLeds;
+    this->bufferType = bufferType;
+    this->ownsBuffer = true;
+    this->leds = allocateBuffer(numLeds);
+    initDefaults();
+}
+
+AvantLumi::AvantLumi(uint8_t dataPin, uint16_t numLeds, CRGB* buffer) {
+    // Caller-provided (e.g. static) buffer of at least numLeds entries; never freed here
+    this->dataPin = dataPin;
+    this->numLeds = numLeds;
+    this->bufferType = LUMI_BUFFER_EXTERNAL;
+    this->ownsBuffer = false;
+    this->leds = buffer;
+    initDefaults();
+}
+
+void AvantLumi::initDefaults() {
+    this->primaryBuffer = leds;
+    this->controller = nullptr;
+    this->doubleBuffered = false;
+    this->frontBuffer = nullptr;
+    this->frontBrightness = 0;
+    this->highPrecision = false;
+    this->ditherResidual = nullptr;
+#if defined(ESP32)
+    this->showTaskHandle = nullptr;
+    this->showDone = nullptr;
+#elif defined(LUMI_PARALLEL_THREADS)
+    this->showBusy = false;
+    this->showStop = false;
+#endif
     
     // Initialize state variables
     fadeinEnabled = true;
@@ -92,45 +313,196 @@ AvantLumi::AvantLumi(uint8_t dataPin, uint16_t numLeds) {
     targetBrightness = brightnessLevels[currentBrightnessLevel];
     actualBrightness = brightnessLevels[currentBrightnessLevel];
     lastBrightnessUpdate = 0;
-    currentPaletteName = "party";
-    solidColorName = "";
+    lastPaletteBlend = 0;
+    currentPaletteId = LUMI_PALETTE_PARTY;
+    solidColorId = LUMI_COLOR_NONE;
     blendSpeed = 4;  // Default to level 4 (fast blending)
     
     // Initialize palettes
     currentPalette = PartyColors_p;
     targetPalette = PartyColors_p;
     currentBlending = LINEARBLEND;
+    sourcePalette = PartyColors_p;
+    crossfadeDuration = 0;  // Legacy nblend behaviour until setCrossfade() is called
+    crossfadeStart = 0;
+    blendSteps = 0;
+    paletteBlendComplete = true;
 
     // Initialize power settings with defaults
     maxVolts = 5;        // Default 5V
     maxMilliamps = 500;  // Default 500mA (same as current hardcoded value)
+    
+    pixelStreamEnabled = false;
+    externalFrame = false;
+    randomEpoch = 0;
+    
+    matrixWidth = 0;
+    matrixHeight = 0;
+    matrixLayout = LUMI_MATRIX_ROWS;
+    panelWidth = 0;
+    panelHeight = 0;
+    xyTable = nullptr;
+    matrixPoints = nullptr;
+    matrixEffect = LUMI_MATRIX_STRIP;
+    
+    keyframeInterval = 0;
+    keyPrev = nullptr;
+    keyNext = nullptr;
+    keyframeAt = 0;
+    keyframeMix = 255;
+    keyframeReady = false;
+    
+    parallelRender = false;
+    workerFirst = 0;
+    workerLast = 0;
+    workerSeed = 0;
+#if defined(LUMI_PARALLEL_FREERTOS)
+    renderTaskHandle = nullptr;
+    renderDone = nullptr;
+#elif defined(LUMI_PARALLEL_THREADS)
+    renderJob = false;
+    renderStop = false;
+#endif
+    
+    renderChunkSize = 0;
+    renderBudgetUs = 0;
+    renderCursor = 0;
+    renderSeed = 0;
+    frameTime = 0;
+    
+    idle = false;
+    powerPin = LUMI_NO_PIN;
+    powerActiveHigh = true;
+    powerSettleMs = 0;
+    powerOn = true;
+    powerOnAt = 0;
+    
+    frameCallback = nullptr;
+    frameCount = 0;
+    commandSince = 0;
+    inUpdate = false;
+    resetLatencyStats();
+    
+    cues = nullptr;
+    timeline = nullptr;
+    pixelReceiver = nullptr;
+    clockSync = nullptr;
+    localClock = defaultMillis;
+    showSeed = 0;
+    
+    audio = nullptr;
+    audioEnabled = false;
+    audioIndexOffset = 0;
+    audioScale = 255;
+    audioBlendSpeed = blendSpeed;
+    
+    coalescing = false;
+    pendingFields = 0;
+    pendingLookKind = 0;
+    pendingRGB = CRGB::Black;
+    pendingLookId = 0;
+    pendingBright = 0;
+    pendingSwitch = false;
+    pendingFade = false;
+    pendingBlendSpeed = 0;
+    commandsReceived = 0;
+    commandsApplied = 0;
+    
+    statusText = nullptr;
+    statusLength = 0;
+    statusDirty = true;
+    statusVersion = 0;
+    statusSerializations = 0;
+    statusLiveVersion = 0;
+    statusLiveAt = 0;
+
+#ifdef AVANTLUMI_PROFILE
+    profileHead = 0;
+    profileCount = 0;
+#endif
 }
 
 // Destructor
 AvantLumi::~AvantLumi() {
-    delete[] leds;
+    setParallelRender(false);
+    setInterpolation(0);
+    freeMatrix();
+    setDoubleBuffer(false);
+    setHighPrecision(false);
+    endAudio();
+    delete cues;
+    delete timeline;
+    delete pixelReceiver;
+    delete clockSync;
+    free(statusText);
+    if (ownsBuffer) {
+        free(leds);
+    }
+}
+
+CRGB* AvantLumi::allocateBuffer(uint16_t count) {
+    size_t bytes = (size_t)count * sizeof(CRGB);
+    void* mem = nullptr;
+    
+    if (bufferType == LUMI_BUFFER_PSRAM) {
+#if defined(ESP32)
+        mem = lumiCounted(ps_malloc(bytes));
+#endif
+    } else {
+        mem = lumiCounted(malloc(bytes));
+    }
+    
+    if (mem != nullptr) {
+        memset(mem, 0, bytes);
+    }
+    return static_cast<CRGB*>(mem);
+}
+
+bool AvantLumi::hasBuffer() {
+    return leds != nullptr;
 }
 
 // Initialization
 bool AvantLumi::begin() {
+    if (leds == nullptr) {
+        return false; // Frame buffer allocation failed
+    }
+    
+    // Matrix lookup tables are built once here rather than per frame
+    if (matrixWidth > 0 && xyTable == nullptr) {
+        buildMatrix();
+    }
+    
+    // In double-buffered mode FastLED only ever sees the front buffer
+    CRGB* output = doubleBuffered ? frontBuffer : leds;
+    if (!addController(output)) {
+        return false;
+    }
+    
+    FastLED.setMaxPowerInVoltsAndMilliamps(maxVolts, maxMilliamps);
+    return true;
+}
+
+bool AvantLumi::addController(CRGB* output) {
     // Note: FastLED addLeds template requires compile-time constants for pin numbers
     // For dynamic pin assignment, we need a different approach
     // This is a limitation of the FastLED library template system
     
     // For now, we'll use a runtime approach with a switch statement
     // Users can modify this section for their specific pin requirements
+    
     switch(dataPin) {
         case 2:
-            FastLED.addLeds<WS2812B, 2, GRB>(leds, numLeds);
+            controller = &FastLED.addLeds<WS2812B, 2, GRB>(output, numLeds);
             break;
         case 3:
-            FastLED.addLeds<WS2812B, 3, GRB>(leds, numLeds);
+            controller = &FastLED.addLeds<WS2812B, 3, GRB>(output, numLeds);
             break;
         case 4:
-            FastLED.addLeds<WS2812B, 4, GRB>(leds, numLeds);
+            controller = &FastLED.addLeds<WS2812B, 4, GRB>(output, numLeds);
             break;
         case 5:
-            FastLED.addLeds<WS2812B, 5, GRB>(leds, numLeds);
+            controller = &FastLED.addLeds<WS2812B, 5, GRB>(output, numLeds);
             break;
         case 6:
             
@@ -148,301 +520,1276 @@ bool AvantLumi::begin() {
             
             break;
         case 11:
-            FastLED.addLeds<WS2812B, 11, GRB>(leds, numLeds);
+            controller = &FastLED.addLeds<WS2812B, 11, GRB>(output, numLeds);
             break;
         case 12:
-            FastLED.addLeds<WS2812B, 12, GRB>(leds, numLeds);
+            controller = &FastLED.addLeds<WS2812B, 12, GRB>(output, numLeds);
             break;
         case 13:
-            FastLED.addLeds<WS2812B, 13, GRB>(leds, numLeds);
+            controller = &FastLED.addLeds<WS2812B, 13, GRB>(output, numLeds);
             break;
         default:
             // Default to pin 2 if unsupported pin is specified
-            FastLED.addLeds<WS2812B, 2, GRB>(leds, numLeds);
+            controller = &FastLED.addLeds<WS2812B, 2, GRB>(output, numLeds);
             return false; // Return false to indicate unsupported pin
     }
-    
-    FastLED.setBrightness(brightnessLevels[currentBrightnessLevel]);
-    FastLED.setMaxPowerInVoltsAndMilliamps(maxVolts, maxMilliamps);
     return true;
 }
 
 // Main update loop
 void AvantLumi::update() {
-    static unsigned long lastPaletteBlend = 0;
-    static unsigned long lastRandomPalette = 0;
+    if (leds == nullptr) {
+        return;
+    }
+    // Changes made by cues, timelines or queued-command flushes below are not commands
+    inUpdate = true;
+    
+    if (clockSync != nullptr && clockSync->getRole() != LUMI_SYNC_OFF) {
+        clockSync->poll();
+    }
+    
+    // Only the earliest cue is examined; nothing runs when no cues are set
+    if (cues != nullptr && cues->count() > 0) {
+        time_t now = cues->now();
+        LumiCue due;
+        while (cues->poll(now, due)) {
+            applyCue(due);
+        }
+    }
+    
+    uint8_t streamFlags = 0;
+    if (pixelStreamEnabled) {
+        // Incoming pixels land directly in the render buffer
+        streamFlags = pixelReceiver->poll((uint8_t*)leds, numLeds * sizeof(CRGB), millis());
+        externalFrame = pixelReceiver->isActive(millis());
+    }
+    
+    if (timeline != nullptr && timeline->isPlaying()) {
+        unsigned long now = showTime();
+        LumiKeyframe kf;
+        while (timeline->next(now, kf)) {
+            applyKeyframe(kf);
+        }
+    }
+    
+    // Commands received since the last frame, including any queued by cues or the timeline
+    if (pendingFields) {
+        flushCommands();
+    }
+    
+    // Nothing to draw until a setter, a stream or audio wakes the strip
+    if (idle) {
+        if (!externalFrame && !audioEnabled) {
+            inUpdate = false;
+            return;
+        }
+        idle = false;
+    }
+    if (!powerOn) {
+        setPower(true);
+    }
+    
+    LUMI_PROFILE_BEGIN();
+    
+    // A chunked frame in progress keeps the state it started with, so it cannot tear
+    bool frameStart = (renderCursor == 0);
+    
+    if (audioEnabled && frameStart) {
+        updateAudio();
+    }
+    LUMI_PROFILE_STAGE(LUMI_STAGE_AUDIO);
     
-    updateBrightness();
+    if (frameStart) {
+        updateBrightness();
+    }
+    LUMI_PROFILE_STAGE(LUMI_STAGE_BRIGHTNESS);
     
     // Blend palettes
-    unsigned long blendInterval;
-    uint8_t maxBlendChanges;
-    getBlendParameters(blendSpeed, blendInterval, maxBlendChanges);
-
-    if (millis() - lastPaletteBlend >= blendInterval) {
-        lastPaletteBlend = millis();
-        nblendPaletteTowardPalette(currentPalette, targetPalette, maxBlendChanges);
+    if (frameStart) {
+        updatePaletteBlend();
+    }
+    LUMI_PROFILE_STAGE(LUMI_STAGE_BLEND);
+    
+    // Generate random palette at fixed show-time boundaries so synced nodes change together
+    if (frameStart) {
+        frameTime = showTime();
+        uint32_t epoch = frameTime / 5000;
+        if (epoch != randomEpoch) {
+            randomEpoch = epoch;
+            if (useRandomPalette && !useSolidColor) {
+                generateRandomPalette();
+            }
+        }
     }
+    LUMI_PROFILE_STAGE(LUMI_STAGE_RANDOM);
     
-    // Generate random palette
-    if (millis() - lastRandomPalette >= 5000) {
-        lastRandomPalette = millis();
-        if (useRandomPalette && !useSolidColor) {
-            generateRandomPalette();
+    bool frameDone = true;
+    if (!externalFrame) {
+        frameDone = keyframeInterval ? renderInterpolated() : renderChunk();
+    } else {
+        renderCursor = 0;
+    }
+    LUMI_PROFILE_STAGE(LUMI_STAGE_RENDER);
+    
+    // External frames are shown when complete; brightness ramps still go out.
+    // Frames are held back until a freshly enabled PSU has settled.
+    bool settled = powerPin == LUMI_NO_PIN || millis() - powerOnAt >= powerSettleMs;
+    if (frameDone && settled &&
+        (!externalFrame || (streamFlags & LUMI_STREAM_FRAME) || actualBrightness != targetBrightness)) {
+        commitFrame();
+        
+        // Idle once this frame is the last one that would differ from the next
+        uint8_t desired = ledEnabled ? brightnessLevels[currentBrightnessLevel] : 0;
+        bool dark = desired == 0 && actualBrightness == 0;
+        // Matrix effects move on their own even with a settled palette
+        bool still = !fadeinEnabled && !useRandomPalette && paletteBlendComplete && !highPrecision &&
+                     actualBrightness == desired && keyframeMix == 255 &&
+                     (matrixEffect == LUMI_MATRIX_STRIP || matrixPoints == nullptr);
+        if ((dark || still) && !externalFrame && !audioEnabled) {
+            idle = true;
+            if (dark) {
+                setPower(false);
+            }
         }
     }
+    LUMI_PROFILE_STAGE(LUMI_STAGE_SHOW);
+    inUpdate = false;
     
-    updateLEDs();
-    FastLED.show();
+#ifdef AVANTLUMI_PROFILE
+    profileHead = (profileHead + 1) % LUMI_PROFILE_WINDOW;
+    if (profileCount < LUMI_PROFILE_WINDOW) {
+        profileCount++;
+    }
+#endif
 }
 
-// Setter methods
-bool AvantLumi::setRGB(uint8_t rVal, uint8_t gVal, uint8_t bVal) {
-    rVal = constrain(rVal, 0, 255);
-    gVal = constrain(gVal, 0, 255);
-    bVal = constrain(bVal, 0, 255);
-    
-    solidColor = CRGB(rVal, gVal, bVal);
-    targetPalette = createSolidPalette(solidColor);
-    useSolidColor = true;
-    useRandomPalette = false;
-    currentPaletteName = "solid_color";
-    solidColorName = "";
+bool AvantLumi::setDoubleBuffer(bool enabled) {
+    if (enabled == doubleBuffered) {
+        return true;
+    }
     
+    if (enabled) {
+        if (leds == nullptr) {
+            return false;
+        }
+        // An external buffer gets its partner from the internal heap
+        frontBuffer = allocateBuffer(numLeds);
+        if (frontBuffer == nullptr) {
+            return false;
+        }
+        copyFrame(frontBuffer, leds);
+#if defined(ESP32)
+        showDone = xSemaphoreCreateBinary();
+        if (showDone == nullptr) {
+            free(frontBuffer);
+            frontBuffer = nullptr;
+            return false;
+        }
+        xSemaphoreGive(showDone);
+        // Transmit from the core the sketch is not running on
+        if (xTaskCreatePinnedToCore(showTask, "lumi_show", 2048, this, 2, &showTaskHandle,
+                                    xPortGetCoreID() == 0 ? 1 : 0) != pdPASS) {
+            vSemaphoreDelete(showDone);
+            showDone = nullptr;
+            free(frontBuffer);
+            frontBuffer = nullptr;
+            return false;
+        }
+#elif defined(LUMI_PARALLEL_THREADS)
+        showBusy = false;
+        showStop = false;
+        if (pthread_create(&showThread, nullptr, showThreadLoop, this) != 0) {
+            free(frontBuffer);
+            frontBuffer = nullptr;
+            return false;
+        }
+#endif
+        if (controller) {
+            controller->setLeds(frontBuffer, numLeds);
+        }
+        doubleBuffered = true;
+    } else {
+        waitForShow();
+#if defined(ESP32)
+        vTaskDelete(showTaskHandle);
+        showTaskHandle = nullptr;
+        vSemaphoreDelete(showDone);
+        showDone = nullptr;
+#elif defined(LUMI_PARALLEL_THREADS)
+        {
+            std::lock_guard<std::mutex> lock(showMutex);
+            showStop = true;
+        }
+        showCv.notify_all();
+        pthread_join(showThread, nullptr);
+#endif
+        // Buffers rotate on every frame; return to the original one and free the extra
+        CRGB* extra = (leds == primaryBuffer) ? frontBuffer : leds;
+        if (leds != primaryBuffer) {
+            copyFrame(primaryBuffer, leds);
+            leds = primaryBuffer;
+        }
+        if (controller) {
+            controller->setLeds(leds, numLeds);
+        }
+        doubleBuffered = false;
+        free(extra);
+        frontBuffer = nullptr;
+    }
     return true;
 }
 
-bool AvantLumi::setColor(String colorName) {
-    colorName.trim();
+bool AvantLumi::getDoubleBuffer() {
+    return doubleBuffered;
+}
+
+void AvantLumi::waitForShow() {
+#if defined(ESP32)
+    if (doubleBuffered) {
+        // Blocks only if the previous frame is still being clocked out
+        xSemaphoreTake(showDone, portMAX_DELAY);
+        xSemaphoreGive(showDone);
+    }
+#elif defined(LUMI_PARALLEL_THREADS)
+    if (doubleBuffered) {
+        std::unique_lock<std::mutex> lock(showMutex);
+        showCv.wait(lock, [this] { return !showBusy; });
+    }
+#endif
+}
+
+void AvantLumi::commitFrame() {
+    if (commandSince != 0) {
+        recordLatency();
+    }
+    frameCount++;
     
-    if (colorName.length() > 0 && isValidColorName(colorName)) {
-        solidColor = parseColorName(colorName);
-        solidColorName = colorName;
-        targetPalette = createSolidPalette(solidColor);
-        useSolidColor = true;
-        useRandomPalette = false;
-        currentPaletteName = "solid_color";
-        return true;
+    // Brightness travels with the frame as the show() scale. FastLED's global
+    // brightness is never set, so a transmitter on the other core cannot pick
+    // up a value meant for a later frame.
+    // 16-bit frames already carry it, unless they came from the network.
+    uint8_t brightness = (highPrecision && !externalFrame) ? 255 : actualBrightness;
+    if (frameCallback) {
+        frameCallback(leds, numLeds, brightness);
     }
-    return false;
+    
+    if (!doubleBuffered) {
+        FastLED.show(brightness);
+        return;
+    }
+    
+    // Fence: the front buffer must not change while it is being transmitted
+#if defined(ESP32)
+    xSemaphoreTake(showDone, portMAX_DELAY);
+#else
+    waitForShow();
+#endif
+    
+    // Hand the finished frame to the transmitter; the old front becomes the render target
+    CRGB* finished = leds;
+    leds = frontBuffer;
+    frontBuffer = finished;
+    if (controller) {
+        controller->setLeds(frontBuffer, numLeds);
+    }
+    frontBrightness = brightness;
+    
+    // Streamed frames may be partial updates, so the new back buffer starts from the last frame
+    if (externalFrame) {
+        copyFrame(leds, frontBuffer);
+    }
+    
+#if defined(ESP32)
+    xTaskNotifyGive(showTaskHandle);
+#elif defined(LUMI_PARALLEL_THREADS)
+    {
+        std::lock_guard<std::mutex> lock(showMutex);
+        showBusy = true;
+    }
+    showCv.notify_all();
+#else
+    FastLED.show(frontBrightness);
+#endif
 }
 
-bool AvantLumi::setBright(uint8_t level) {
-    if (level >= 1 && level <= 5) {
-        currentBrightnessLevel = level;
-        return true;
+#if defined(ESP32)
+void AvantLumi::showTask(void* arg) {
+    AvantLumi* self = static_cast<AvantLumi*>(arg);
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        FastLED.show(self->frontBrightness);
+        xSemaphoreGive(self->showDone);
     }
-    return false;
 }
+#elif defined(LUMI_PARALLEL_THREADS)
+void* AvantLumi::showThreadLoop(void* arg) {
+    AvantLumi* self = static_cast<AvantLumi*>(arg);
+    std::unique_lock<std::mutex> lock(self->showMutex);
+    for (;;) {
+        self->showCv.wait(lock, [self] { return self->showBusy || self->showStop; });
+        if (self->showStop) {
+            return nullptr;
+        }
+        lock.unlock();
+        FastLED.show(self->frontBrightness);
+        lock.lock();
+        self->showBusy = false;
+        self->showCv.notify_all();
+    }
+}
+#endif
 
-bool AvantLumi::setSwitch(String state) {
-    state.toLowerCase();
-    state.trim();
-    
-    if (state == "on") {
-        ledEnabled = true;
-        return true;
-    } else if (state == "off") {
-        ledEnabled = false;
+bool AvantLumi::setMatrix(uint8_t width, uint8_t height, uint8_t layout, uint8_t panelW, uint8_t panelH) {
+    if (width == 0 || height == 0) {
+        freeMatrix();
+        matrixWidth = 0;
+        matrixHeight = 0;
         return true;
     }
-    return false;
+    
+    uint8_t pw = panelW ? panelW : width;
+    uint8_t ph = panelH ? panelH : height;
+    if ((uint32_t)width * height > numLeds || width % pw != 0 || height % ph != 0) {
+        return false;
+    }
+    
+    freeMatrix();
+    matrixWidth = width;
+    matrixHeight = height;
+    matrixLayout = layout;
+    panelWidth = pw;
+    panelHeight = ph;
+    
+    // Before begin() the tables are built there; afterwards, right away
+    return controller == nullptr || buildMatrix();
 }
 
-bool AvantLumi::setSwitch(bool state) {
-    ledEnabled = state;
+bool AvantLumi::buildMatrix() {
+    uint16_t count = (uint16_t)matrixWidth * matrixHeight;
+    xyTable = lumiCounted((uint16_t*)malloc(count * sizeof(uint16_t)));
+    matrixPoints = lumiCounted((LumiMatrixPoint*)malloc(count * sizeof(LumiMatrixPoint)));
+    if (xyTable == nullptr || matrixPoints == nullptr) {
+        freeMatrix();
+        return false;
+    }
+    
+    uint8_t panelsX = matrixWidth / panelWidth;
+    uint16_t panelSize = (uint16_t)panelWidth * panelHeight;
+    float cx = (matrixWidth - 1) / 2.0f;
+    float cy = (matrixHeight - 1) / 2.0f;
+    float maxRadius = sqrtf(cx * cx + cy * cy);
+    
+    for (uint8_t y = 0; y < matrixHeight; y++) {
+        for (uint8_t x = 0; x < matrixWidth; x++) {
+            // Which panel, and where inside it
+            uint8_t px = x / panelWidth;
+            uint8_t py = y / panelHeight;
+            uint8_t lx = x % panelWidth;
+            uint8_t ly = y % panelHeight;
+            if ((matrixLayout & LUMI_MATRIX_PANEL_SERPENTINE) && (py & 1)) {
+                px = panelsX - 1 - px;
+            }
+            
+            uint8_t major = ly, minor = lx, minorLength = panelWidth;
+            if (matrixLayout & LUMI_MATRIX_COLUMNS) {
+                major = lx;
+                minor = ly;
+                minorLength = panelHeight;
+            }
+            if ((matrixLayout & LUMI_MATRIX_SERPENTINE) && (major & 1)) {
+                minor = minorLength - 1 - minor;
+            }
+            
+            uint16_t index = ((uint16_t)py * panelsX + px) * panelSize + (uint16_t)major * minorLength + minor;
+            xyTable[(uint16_t)y * matrixWidth + x] = index;
+            
+            LumiMatrixPoint& p = matrixPoints[index];
+            p.x = x;
+            p.y = y;
+            float dx = x - cx;
+            float dy = y - cy;
+            p.radius = maxRadius > 0 ? (uint8_t)(sqrtf(dx * dx + dy * dy) * 255 / maxRadius) : 0;
+            p.along = matrixWidth > 1 ? (uint8_t)((uint16_t)x * 255 / (matrixWidth - 1)) : 0;
+        }
+    }
     return true;
 }
 
-bool AvantLumi::setFade(String state) {
-    state.toLowerCase();
-    state.trim();
-    
-    if (state == "on") {
-        fadeinEnabled = true;
-        return true;
-    } else if (state == "off") {
-        fadeinEnabled = false;
-        return true;
+void AvantLumi::freeMatrix() {
+    free(xyTable);
+    free(matrixPoints);
+    xyTable = nullptr;
+    matrixPoints = nullptr;
+}
+
+uint16_t AvantLumi::XY(uint8_t x, uint8_t y) {
+    if (xyTable == nullptr || x >= matrixWidth || y >= matrixHeight) {
+        return LUMI_XY_NONE;
     }
-    return false;
+    return xyTable[(uint16_t)y * matrixWidth + x];
 }
 
-bool AvantLumi::setFade(bool state) {
-    fadeinEnabled = state;
+bool AvantLumi::setMatrixEffect(LumiMatrixEffect effect) {
+    if (effect > LUMI_MATRIX_PLASMA) {
+        return false;
+    }
+    markStatusDirty();
+    matrixEffect = effect;
     return true;
 }
 
-bool AvantLumi::setPalette(String paletteName) {
-    paletteName.toLowerCase();
-    paletteName.trim();
-    useSolidColor = false;
+LumiMatrixEffect AvantLumi::getMatrixEffect() {
+    return matrixEffect;
+}
+
+uint8_t AvantLumi::getMatrixWidth() {
+    return matrixWidth;
+}
+
+uint8_t AvantLumi::getMatrixHeight() {
+    return matrixHeight;
+}
+
+bool AvantLumi::setParallelRender(bool enabled) {
+    if (enabled == parallelRender) {
+        return true;
+    }
     
-    if (paletteName == "rainbow") {
-        targetPalette = RainbowColors_p;
-        useRandomPalette = false;
-        currentPaletteName = "rainbow";
-    }
-    else if (paletteName == "party") {
-        targetPalette = PartyColors_p;
-        useRandomPalette = false;
-        currentPaletteName = "party";
-    }
-    else if (paletteName == "ocean") {
-        targetPalette = OceanColors_p;
-        useRandomPalette = false;
-        currentPaletteName = "ocean";
-    }
-    else if (paletteName == "forest") {
-        targetPalette = ForestColors_p;
-        useRandomPalette = false;
-        currentPaletteName = "forest";
-    }
-    else if (paletteName == "heat") {
-        targetPalette = HeatColors_p;
-        useRandomPalette = false;
-        currentPaletteName = "heat";
-    }
-    else if (paletteName == "cloud") {
-        targetPalette = CloudColors_p;
-        useRandomPalette = false;
-        currentPaletteName = "cloud";
-    }
-    else if (paletteName == "lava") {
-        targetPalette = LavaColors_p;
-        useRandomPalette = false;
-        currentPaletteName = "lava";
-    }
-    else if (paletteName == "u01" || paletteName == "christmas") {
-        targetPalette = christmas_p;
-        useRandomPalette = false;
-        currentPaletteName = "u01_christmas";
-    }
-    else if (paletteName == "u02" || paletteName == "autumn") {
-        targetPalette = autumn_p;
-        useRandomPalette = false;
-        currentPaletteName = "u02_autumn";
-    }
-    else if (paletteName == "u03" || paletteName == "cyberpunk") {
-        targetPalette = cyberpunk_p;
-        useRandomPalette = false;
-        currentPaletteName = "u03_cyberpunk";
-    }
-    else if (paletteName == "u04" || paletteName == "halloween") {
-        targetPalette = halloween_p;
-        useRandomPalette = false;
-        currentPaletteName = "u04_halloween";
-    }
-    else if (paletteName == "u05" || paletteName == "winter") {
-        targetPalette = winter_p;
-        useRandomPalette = false;
-        currentPaletteName = "u05_winter";
-    }
-    else if (paletteName == "u06" || paletteName == "spring") {
-        targetPalette = spring_p;
-        useRandomPalette = false;
-        currentPaletteName = "u06_spring";
-    }
-    else if (paletteName == "u07" || paletteName == "sunset") {
-        targetPalette = sunset_p;
-        useRandomPalette = false;
-        currentPaletteName = "u07_sunset";
-    }
-    else if (paletteName == "u08" || paletteName == "deep_ocean") {
-        targetPalette = ocean_deep_p;
-        useRandomPalette = false;
-        currentPaletteName = "u08_deep_ocean";
-    }
-    else if (paletteName == "u09" || paletteName == "neon") {
-        targetPalette = neon_p;
-        useRandomPalette = false;
-        currentPaletteName = "u09_neon";
-    }
-    else if (paletteName == "u10" || paletteName == "fire") {
-        targetPalette = fire_p;
-        useRandomPalette = false;
-        currentPaletteName = "u10_fire";
-    }
-    else if (paletteName == "random") {
-        useRandomPalette = true;
-        currentPaletteName = "random";
-    }
-    else {
-        return false; // Unknown palette
+#if defined(LUMI_PARALLEL_FREERTOS)
+    if (enabled) {
+        renderDone = xSemaphoreCreateBinary();
+        if (renderDone == nullptr) {
+            return false;
+        }
+        if (xTaskCreatePinnedToCore(renderTask, "lumi_render", 3072, this, 2, &renderTaskHandle,
+                                    xPortGetCoreID() == 0 ? 1 : 0) != pdPASS) {
+            vSemaphoreDelete(renderDone);
+            renderDone = nullptr;
+            return false;
+        }
+    } else {
+        // The worker is always joined inside update(), so it is idle here
+        vTaskDelete(renderTaskHandle);
+        renderTaskHandle = nullptr;
+        vSemaphoreDelete(renderDone);
+        renderDone = nullptr;
+    }
+#elif defined(LUMI_PARALLEL_THREADS)
+    if (enabled) {
+        renderJob = false;
+        renderStop = false;
+        renderThread = std::thread(&AvantLumi::renderThreadLoop, this);
+    } else {
+        {
+            std::lock_guard<std::mutex> lock(renderMutex);
+            renderStop = true;
+        }
+        renderCv.notify_all();
+        renderThread.join();
     }
+#else
+    return false; // Single-core target
+#endif
     
+    parallelRender = enabled;
     return true;
 }
 
-// Getter methods
-CRGB AvantLumi::getRGB() {
-    return solidColor;
+bool AvantLumi::getParallelRender() {
+    return parallelRender;
 }
 
-String AvantLumi::getColor() {
-    return solidColorName;
+#if defined(LUMI_PARALLEL_FREERTOS)
+void AvantLumi::startWorker(uint16_t first, uint16_t last, uint16_t seed) {
+    workerFirst = first;
+    workerLast = last;
+    workerSeed = seed;
+    xTaskNotifyGive(renderTaskHandle);
 }
 
-uint8_t AvantLumi::getBright() {
-    return currentBrightnessLevel;
+uint16_t AvantLumi::joinWorker() {
+    xSemaphoreTake(renderDone, portMAX_DELAY);
+    return workerSeed;
 }
 
-bool AvantLumi::getSwitch() {
-    return ledEnabled;
+void AvantLumi::renderTask(void* arg) {
+    AvantLumi* self = static_cast<AvantLumi*>(arg);
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        self->workerSeed = self->renderSlice(self->workerFirst, self->workerLast, self->workerSeed);
+        xSemaphoreGive(self->renderDone);
+    }
+}
+#elif defined(LUMI_PARALLEL_THREADS)
+void AvantLumi::startWorker(uint16_t first, uint16_t last, uint16_t seed) {
+    {
+        std::lock_guard<std::mutex> lock(renderMutex);
+        workerFirst = first;
+        workerLast = last;
+        workerSeed = seed;
+        renderJob = true;
+    }
+    renderCv.notify_all();
 }
 
-bool AvantLumi::getFade() {
-    return fadeinEnabled;
+uint16_t AvantLumi::joinWorker() {
+    std::unique_lock<std::mutex> lock(renderMutex);
+    renderCv.wait(lock, [this] { return !renderJob; });
+    return workerSeed;
 }
 
-String AvantLumi::getPalette() {
-    if (useSolidColor) {
-        return "solid_color";
+void AvantLumi::renderThreadLoop() {
+    std::unique_lock<std::mutex> lock(renderMutex);
+    for (;;) {
+        renderCv.wait(lock, [this] { return renderJob || renderStop; });
+        if (renderStop) {
+            return;
+        }
+        lock.unlock();
+        uint16_t seed = renderSlice(workerFirst, workerLast, workerSeed);
+        lock.lock();
+        workerSeed = seed;
+        renderJob = false;
+        renderCv.notify_all();
     }
-    return currentPaletteName;
+}
+#else
+void AvantLumi::startWorker(uint16_t first, uint16_t last, uint16_t seed) {
+    workerSeed = renderSlice(first, last, seed);
 }
 
-String AvantLumi::getStatus() {
-    String status = "{";
-    
-    // Switch status - changed from "sw" to "switch"
-    status += "\"switch\":\"" + String(ledEnabled ? "on" : "off") + "\",";
-    
-    // Brightness level - changed from "br" to "bright"
-    status += "\"bright\":" + String(currentBrightnessLevel) + ",";
-    
-    // Fade status - changed from "fd" to "fade"
-    status += "\"fade\":\"" + String(fadeinEnabled ? "on" : "off") + "\",";
-    
-    // Color/Palette information
-    if (useSolidColor) {
-        // Changed from "cr" to "rgb" and "cn" to "color"
-        status += "\"rgb\":{";
-        status += "\"r\":" + String(solidColor.r) + ",";
-        status += "\"g\":" + String(solidColor.g) + ",";
-        status += "\"b\":" + String(solidColor.b);
-        if (solidColorName.length() > 0) {
-            status += ",\"color\":\"" + solidColorName + "\"";
-        }
-        status += "}";
-    } else {
-        // Changed from "pal" to "palette"
-        status += "\"palette\":\"" + currentPaletteName + "\"";
+uint16_t AvantLumi::joinWorker() {
+    return workerSeed;
+}
+#endif
+
+bool AvantLumi::setChunkedRender(uint16_t chunkLeds, uint32_t budgetUs) {
+    if (chunkLeds > 0 && budgetUs == 0) {
+        return false;
     }
+    renderChunkSize = chunkLeds;
+    renderBudgetUs = budgetUs;
+    renderCursor = 0;   // Restart the frame in progress
+    return true;
+}
 
-    // Changed from "pwr" to "power"
-    status += ",\"power\":{\"v\":" + String(maxVolts) + ",\"ma\":" + String(maxMilliamps) + "}";
-    
-    // Keep blend_spd as is since it's not a command name, it's a parameter name
-    status += ",\"blend_spd\":" + String(blendSpeed);
-    
-    status += "}";
-    
-    return status;
+uint16_t AvantLumi::getChunkSize() {
+    return renderChunkSize;
 }
 
-// Private helper methods
-CRGBPalette16 AvantLumi::createSolidPalette(CRGB color) {
+bool AvantLumi::setInterpolation(uint16_t keyframeMs) {
+    if (keyframeMs > 1000) {
+        return false;
+    }
+    if (keyframeMs > 0 && keyPrev == nullptr) {
+        if (leds == nullptr) {
+            return false;
+        }
+        keyPrev = allocateBuffer(numLeds);
+        keyNext = allocateBuffer(numLeds);
+        if (keyPrev == nullptr || keyNext == nullptr) {
+            free(keyPrev);
+            free(keyNext);
+            keyPrev = nullptr;
+            keyNext = nullptr;
+            return false;
+        }
+    } else if (keyframeMs == 0) {
+        free(keyPrev);
+        free(keyNext);
+        keyPrev = nullptr;
+        keyNext = nullptr;
+    }
+    keyframeInterval = keyframeMs;
+    keyframeReady = false;
+    keyframeMix = 255;
+    renderCursor = 0;   // A chunked frame in progress belongs to the old target
+    idle = false;
+    return true;
+}
+
+uint16_t AvantLumi::getInterpolation() {
+    return keyframeInterval;
+}
+
+bool AvantLumi::isIdle() {
+    return idle;
+}
+
+uint32_t AvantLumi::getIdleSleepMs() {
+    if (!idle) {
+        return 0;
+    }
+    
+    uint32_t sleepMs = LUMI_IDLE_FOREVER;
+    if (cues != nullptr && cues->count() > 0) {
+        time_t now = cues->now();
+        time_t next = cues->nextFireTime();
+        sleepMs = next > now ? (uint32_t)min((time_t)(next - now), (time_t)(LUMI_IDLE_FOREVER / 1000)) * 1000 : 0;
+    }
+    
+    // Sockets and timelines are serviced by update() itself
+    bool polling = (timeline != nullptr && timeline->isPlaying()) || pixelStreamEnabled ||
+                   (clockSync != nullptr && clockSync->getRole() != LUMI_SYNC_OFF);
+    if (polling) {
+        sleepMs = min(sleepMs, (uint32_t)LUMI_IDLE_POLL_MS);
+    }
+    return sleepMs;
+}
+
+bool AvantLumi::setPowerPin(uint8_t pin, bool activeHigh, uint16_t settleMs) {
+    if (pin == LUMI_NO_PIN) {
+        setPower(true);
+        powerPin = LUMI_NO_PIN;
+        return true;
+    }
+    
+    powerPin = pin;
+    powerActiveHigh = activeHigh;
+    powerSettleMs = settleMs;
+    pinMode(pin, OUTPUT);
+    powerOn = false;
+    setPower(true);
+    return true;
+}
+
+bool AvantLumi::getPowerState() {
+    return powerOn;
+}
+
+void AvantLumi::setPower(bool on) {
+    if (on == powerOn) {
+        return;
+    }
+    powerOn = on;
+    if (powerPin == LUMI_NO_PIN) {
+        return;
+    }
+    digitalWrite(powerPin, (on == powerActiveHigh) ? HIGH : LOW);
+    if (on) {
+        powerOnAt = millis();
+    }
+}
+
+bool AvantLumi::setHighPrecision(bool enabled) {
+    if (enabled == highPrecision) {
+        return true;
+    }
+    
+    if (enabled) {
+        // Three remainder bytes per LED - the same size as a frame buffer
+        ditherResidual = allocateBuffer(numLeds);
+        if (ditherResidual == nullptr) {
+            return false;
+        }
+    } else {
+        free(ditherResidual);
+        ditherResidual = nullptr;
+    }
+    highPrecision = enabled;
+    idle = false;
+    return true;
+}
+
+bool AvantLumi::getHighPrecision() {
+    return highPrecision;
+}
+
+// Setter methods
+bool AvantLumi::setRGB(uint8_t rVal, uint8_t gVal, uint8_t bVal) {
+    rVal = constrain(rVal, 0, 255);
+    gVal = constrain(gVal, 0, 255);
+    bVal = constrain(bVal, 0, 255);
+    
+    if (queueCommand(CMD_LOOK)) {
+        pendingLookKind = LOOK_RGB;
+        pendingRGB = CRGB(rVal, gVal, bVal);
+        return true;
+    }
+    
+    applySolidColor(CRGB(rVal, gVal, bVal));
+    solidColorId = LUMI_COLOR_NONE;
+    
+    return true;
+}
+
+bool AvantLumi::setColor(String colorName) {
+    colorName.trim();
+    
+    int id = colorName.length() > 0 ? findColorId(colorName) : -1;
+    if (id >= 0 && queueCommand(CMD_LOOK)) {
+        pendingLookKind = LOOK_COLOR;
+        pendingLookId = id;
+        return true;
+    }
+    if (id >= 0) {
+        applySolidColor(CRGB(namedColors[id].rgb));
+        solidColorId = id;
+        return true;
+    }
+    return false;
+}
+
+bool AvantLumi::setColorId(uint8_t id) {
+    if (id >= NAMED_COLOR_COUNT) {
+        return false;
+    }
+    if (queueCommand(CMD_LOOK)) {
+        pendingLookKind = LOOK_COLOR;
+        pendingLookId = id;
+        return true;
+    }
+    applySolidColor(CRGB(namedColors[id].rgb));
+    solidColorId = id;
+    return true;
+}
+
+bool AvantLumi::setBright(uint8_t level) {
+    if (level >= 1 && level <= 5) {
+        if (queueCommand(CMD_BRIGHT)) {
+            pendingBright = level;
+            return true;
+        }
+        markStatusDirty();
+        currentBrightnessLevel = level;
+        return true;
+    }
+    return false;
+}
+
+bool AvantLumi::setSwitch(String state) {
+    state.toLowerCase();
+    state.trim();
+    
+    if (state == "on") {
+        return setSwitch(true);
+    } else if (state == "off") {
+        return setSwitch(false);
+    }
+    return false;
+}
+
+bool AvantLumi::setSwitch(bool state) {
+    if (queueCommand(CMD_SWITCH)) {
+        pendingSwitch = state;
+        return true;
+    }
+    markStatusDirty();
+    ledEnabled = state;
+    return true;
+}
+
+bool AvantLumi::setFade(String state) {
+    state.toLowerCase();
+    state.trim();
+    
+    if (state == "on") {
+        return setFade(true);
+    } else if (state == "off") {
+        return setFade(false);
+    }
+    return false;
+}
+
+bool AvantLumi::setFade(bool state) {
+    if (queueCommand(CMD_FADE)) {
+        pendingFade = state;
+        return true;
+    }
+    markStatusDirty();
+    fadeinEnabled = state;
+    return true;
+}
+
+bool AvantLumi::setPalette(String paletteName) {
+    paletteName.toLowerCase();
+    paletteName.trim();
+    
+    int id = findPaletteId(paletteName);
+    if (id < 0) {
+        return false; // Unknown palette
+    }
+    return setPaletteId(id);
+}
+
+bool AvantLumi::setPaletteId(uint8_t id) {
+    if (id >= LUMI_PALETTE_COUNT) {
+        return false;
+    }
+    if (queueCommand(CMD_LOOK)) {
+        pendingLookKind = LOOK_PALETTE;
+        pendingLookId = id;
+        return true;
+    }
+    
+    markStatusDirty();
+    useSolidColor = false;
+    useRandomPalette = (id == LUMI_PALETTE_RANDOM);
+    currentPaletteId = id;
+    
+    switch (id) {
+        case LUMI_PALETTE_RAINBOW:    targetPalette = RainbowColors_p; break;
+        case LUMI_PALETTE_PARTY:      targetPalette = PartyColors_p;   break;
+        case LUMI_PALETTE_OCEAN:      targetPalette = OceanColors_p;   break;
+        case LUMI_PALETTE_FOREST:     targetPalette = ForestColors_p;  break;
+        case LUMI_PALETTE_HEAT:       targetPalette = HeatColors_p;    break;
+        case LUMI_PALETTE_CLOUD:      targetPalette = CloudColors_p;   break;
+        case LUMI_PALETTE_LAVA:       targetPalette = LavaColors_p;    break;
+        case LUMI_PALETTE_CHRISTMAS:  targetPalette = christmas_p;     break;
+        case LUMI_PALETTE_AUTUMN:     targetPalette = autumn_p;        break;
+        case LUMI_PALETTE_CYBERPUNK:  targetPalette = cyberpunk_p;     break;
+        case LUMI_PALETTE_HALLOWEEN:  targetPalette = halloween_p;     break;
+        case LUMI_PALETTE_WINTER:     targetPalette = winter_p;        break;
+        case LUMI_PALETTE_SPRING:     targetPalette = spring_p;        break;
+        case LUMI_PALETTE_SUNSET:     targetPalette = sunset_p;        break;
+        case LUMI_PALETTE_DEEP_OCEAN: targetPalette = ocean_deep_p;    break;
+        case LUMI_PALETTE_NEON:       targetPalette = neon_p;          break;
+        case LUMI_PALETTE_FIRE:       targetPalette = fire_p;          break;
+        default:                      break; // Random keeps the current target until the next generation
+    }
+    
+    startPaletteTransition();
+    return true;
+}
+
+int AvantLumi::findPaletteId(const String& paletteName) {
+    return findPaletteId(paletteName.c_str(), paletteName.length());
+}
+
+static bool nameMatches(const char* name, size_t length, const char* candidate) {
+    return candidate && strncasecmp(name, candidate, length) == 0 && candidate[length] == '\0';
+}
+
+int AvantLumi::findPaletteId(const char* name, size_t length) {
+    // Accepts the plain name, the "uNN" alias and the reported status name
+    for (uint8_t i = 0; i < LUMI_PALETTE_COUNT; i++) {
+        if (nameMatches(name, length, paletteInfo[i].name) ||
+            nameMatches(name, length, paletteInfo[i].statusName) ||
+            nameMatches(name, length, paletteInfo[i].alias)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+LumiCommandResult AvantLumi::applyCommand(const char* json, size_t length) {
+    LumiCommandResult result = { LUMI_CMD_OK, 0, 0, nullptr, 0 };
+    LumiJsonToken key, value;
+    int8_t status;
+    
+    // Check the whole object first so a truncated or run-on message changes nothing
+    LumiJsonReader check(json, length);
+    if (!check.begin()) {
+        result.error = LUMI_CMD_SYNTAX;
+        result.offset = check.offset();
+        return result;
+    }
+    while ((status = check.next(key, value)) > 0) {
+    }
+    if (status < 0 || !check.finish()) {
+        result.error = LUMI_CMD_SYNTAX;
+        result.offset = check.offset();
+        return result;
+    }
+    
+    LumiJsonReader reader(json, length);
+    reader.begin();
+    while (reader.next(key, value) > 0) {
+        LumiCommandError error = applyField(key, value);
+        if (error != LUMI_CMD_OK) {
+            result.error = error;
+            result.offset = (error == LUMI_CMD_UNKNOWN_FIELD ? key.start : value.start) - json;
+            result.field = key.start;
+            result.fieldLength = key.length > 255 ? 255 : key.length;
+            return result;
+        }
+        result.applied++;
+    }
+    return result;
+}
+
+LumiCommandError AvantLumi::applyField(const LumiJsonToken& key, const LumiJsonToken& value) {
+    int32_t number;
+    bool flag;
+    int32_t items[3];
+    bool ok;
+    
+    if (LumiJsonReader::equals(key, "switch") || LumiJsonReader::equals(key, "fade")) {
+        // true/false or "on"/"off"
+        if (value.type == LUMI_JSON_STRING && (LumiJsonReader::equals(value, "on") || LumiJsonReader::equals(value, "off"))) {
+            flag = (value.length == 2);
+        } else if (!LumiJsonReader::toBool(value, flag)) {
+            return LUMI_CMD_BAD_VALUE;
+        }
+        ok = LumiJsonReader::equals(key, "switch") ? setSwitch(flag) : setFade(flag);
+    } else if (LumiJsonReader::equals(key, "bright")) {
+        ok = LumiJsonReader::toInt(value, number) && number >= 0 && number <= 255 && setBright(number);
+    } else if (LumiJsonReader::equals(key, "blend") || LumiJsonReader::equals(key, "blend_spd")) {
+        ok = LumiJsonReader::toInt(value, number) && number >= 0 && number <= 255 && setBlendSpeed(number);
+    } else if (LumiJsonReader::equals(key, "crossfade")) {
+        ok = LumiJsonReader::toInt(value, number) && number >= 0 && setCrossfade(number);
+    } else if (LumiJsonReader::equals(key, "rgb")) {
+        ok = LumiJsonReader::toInts(value, items, 3) == 3 &&
+             items[0] >= 0 && items[0] <= 255 && items[1] >= 0 && items[1] <= 255 &&
+             items[2] >= 0 && items[2] <= 255 && setRGB(items[0], items[1], items[2]);
+    } else if (LumiJsonReader::equals(key, "color")) {
+        int id = (value.type == LUMI_JSON_STRING) ? findColorId(value.start, value.length) : -1;
+        ok = id >= 0 && setColorId(id);
+    } else if (LumiJsonReader::equals(key, "palette")) {
+        // Name or palette id
+        int id = -1;
+        if (value.type == LUMI_JSON_STRING) {
+            id = findPaletteId(value.start, value.length);
+        } else if (LumiJsonReader::toInt(value, number) && number >= 0 && number <= 255) {
+            id = number;
+        }
+        ok = id >= 0 && setPaletteId(id);
+    } else if (LumiJsonReader::equals(key, "power")) {
+        // [volts, milliamps]
+        ok = LumiJsonReader::toInts(value, items, 2) == 2 &&
+             items[0] >= 0 && items[0] <= 255 && items[1] >= 0 && setMaxPower(items[0], items[1]);
+    } else if (LumiJsonReader::equals(key, "preset")) {
+        ok = LumiJsonReader::toInt(value, number) && number >= 0 && number <= 255 && recallPreset(number);
+    } else if (LumiJsonReader::equals(key, "config")) {
+        if (LumiJsonReader::equals(value, "save") && value.type == LUMI_JSON_STRING) {
+            ok = saveConfig();
+        } else if (LumiJsonReader::equals(value, "load") && value.type == LUMI_JSON_STRING) {
+            ok = loadConfig();
+        } else {
+            ok = false;
+        }
+    } else {
+        return LUMI_CMD_UNKNOWN_FIELD;
+    }
+    return ok ? LUMI_CMD_OK : LUMI_CMD_BAD_VALUE;
+}
+
+const char* AvantLumi::commandErrorText(LumiCommandError error) {
+    switch (error) {
+        case LUMI_CMD_OK:            return "ok";
+        case LUMI_CMD_SYNTAX:        return "malformed JSON";
+        case LUMI_CMD_UNKNOWN_FIELD: return "unknown field";
+        case LUMI_CMD_BAD_VALUE:     return "invalid value";
+    }
+    return "unknown error";
+}
+
+// Getter methods
+CRGB AvantLumi::getRGB() {
+    return solidColor;
+}
+
+String AvantLumi::getColor() {
+    return colorName();
+}
+
+uint8_t AvantLumi::getBright() {
+    return currentBrightnessLevel;
+}
+
+bool AvantLumi::getSwitch() {
+    return ledEnabled;
+}
+
+bool AvantLumi::getFade() {
+    return fadeinEnabled;
+}
+
+String AvantLumi::getPalette() {
+    return paletteName();
+}
+
+const char* AvantLumi::colorName() {
+    return solidColorId < NAMED_COLOR_COUNT ? namedColors[solidColorId].name : "";
+}
+
+const char* AvantLumi::paletteName() {
+    if (useSolidColor || currentPaletteId >= LUMI_PALETTE_COUNT) {
+        return "solid_color";
+    }
+    return paletteInfo[currentPaletteId].statusName;
+}
+
+uint8_t AvantLumi::getPaletteId() {
+    return useSolidColor ? (uint8_t)LUMI_PALETTE_SOLID : currentPaletteId;
+}
+
+const char* AvantLumi::getStatusJson() {
+    // Serialized at most once per change, however many readers there are
+    if (statusText == nullptr) {
+        statusText = lumiCounted(static_cast<char*>(malloc(LUMI_STATUS_JSON_SIZE + LUMI_STATUS_SIZE)));
+        if (statusText == nullptr) {
+            return "{}";
+        }
+        statusText[LUMI_STATUS_JSON_SIZE] = '\0';
+        statusDirty = true;
+    }
+    if (statusDirty) {
+        buildStatus();
+        statusDirty = false;
+        statusSerializations++;
+    }
+    return statusText;
+}
+
+String AvantLumi::getStatus() {
+    return String(getStatusText());
+}
+
+const char* AvantLumi::getStatusText() {
+    // Rebuilt after a state change, otherwise the same text is handed out for
+    // up to LUMI_STATUS_LIVE_MS; neither path allocates
+    const char* cached = getStatusJson();
+    if (statusText == nullptr) {
+        return cached;
+    }
+    char* status = statusText + LUMI_STATUS_JSON_SIZE;
+    unsigned long now = millis();
+    if (status[0] != '\0' && statusLiveVersion == statusVersion && now - statusLiveAt < LUMI_STATUS_LIVE_MS) {
+        return status;
+    }
+    statusLiveVersion = statusVersion;
+    statusLiveAt = now;
+    
+    // State without its closing brace, then the live sections
+    uint16_t length = statusLength - 1;
+    memcpy(status, cached, length);
+    status[length] = '\0';
+    
+    // Memory footprint and heap health
+    LumiMemoryStats mem = getMemoryStats();
+    appendStatus(status, LUMI_STATUS_SIZE, length,
+                 ",\"mem\":{\"inst\":%lu,\"fb\":%lu,\"allocs\":%lu,\"heap\":%lu,\"heap_min\":%lu,\"max_blk\":%lu,\"psram\":%lu}",
+                 (unsigned long)mem.instanceBytes, (unsigned long)mem.frameBufferBytes,
+                 (unsigned long)mem.allocations, (unsigned long)mem.freeHeap,
+                 (unsigned long)mem.minFreeHeap, (unsigned long)mem.largestFreeBlock,
+                 (unsigned long)mem.freePsram);
+    
+    // Command-to-photon latency histogram
+    appendStatus(status, LUMI_STATUS_SIZE, length,
+                 ",\"lat\":{\"n\":%lu,\"min_us\":%lu,\"mean_us\":%lu,\"max_us\":%lu,\"hist\":[",
+                 (unsigned long)latency.count, (unsigned long)latency.minUs,
+                 (unsigned long)latency.meanUs, (unsigned long)latency.maxUs);
+    for (uint8_t i = 0; i < LUMI_LATENCY_BUCKETS; i++) {
+        appendStatus(status, LUMI_STATUS_SIZE, length, i > 0 ? ",%lu" : "%lu", (unsigned long)latency.buckets[i]);
+    }
+    appendStatus(status, LUMI_STATUS_SIZE, length, "]}}");
+    
+    return status;
+}
+
+void AvantLumi::noteCommand() {
+    if (commandSince == 0 && !inUpdate) {
+        commandSince = micros();
+        if (commandSince == 0) {
+            commandSince = 1;
+        }
+    }
+}
+
+void AvantLumi::recordLatency() {
+    // Taken when the frame is handed to FastLED.show() (or to the show task)
+    uint32_t elapsed = micros() - commandSince;
+    commandSince = 0;
+    
+    uint32_t ms = elapsed / 1000;
+    uint8_t bucket = 0;
+    while (ms > 0 && bucket < LUMI_LATENCY_BUCKETS - 1) {
+        ms >>= 1;
+        bucket++;
+    }
+    latency.buckets[bucket]++;
+    
+    if (latency.count == 0 || elapsed < latency.minUs) {
+        latency.minUs = elapsed;
+    }
+    if (elapsed > latency.maxUs) {
+        latency.maxUs = elapsed;
+    }
+    latency.count++;
+    latencySum += elapsed;
+    latency.meanUs = (uint32_t)(latencySum / latency.count);
+}
+
+LumiLatencyStats AvantLumi::getLatencyStats() {
+    return latency;
+}
+
+void AvantLumi::resetLatencyStats() {
+    memset(&latency, 0, sizeof(latency));
+    latencySum = 0;
+}
+
+uint32_t AvantLumi::getStatusVersion() {
+    return statusVersion;
+}
+
+uint32_t AvantLumi::getStatusSerializations() {
+    return statusSerializations;
+}
+
+void AvantLumi::markStatusDirty() {
+    statusDirty = true;
+    statusVersion++;
+    idle = false;
+    noteCommand();
+}
+
+void AvantLumi::buildStatus() {
+    char* status = statusText;
+    uint16_t& length = statusLength;
+    length = 0;
+    
+    // "switch", "bright" and "fade" - changed from "sw", "br" and "fd"
+    appendStatus(status, LUMI_STATUS_JSON_SIZE, length, "{\"switch\":\"%s\",\"bright\":%u,\"fade\":\"%s\",",
+                 ledEnabled ? "on" : "off", (unsigned)currentBrightnessLevel, fadeinEnabled ? "on" : "off");
+    
+    // Color/Palette information
+    if (useSolidColor) {
+        // Changed from "cr" to "rgb" and "cn" to "color"
+        appendStatus(status, LUMI_STATUS_JSON_SIZE, length, "\"rgb\":{\"r\":%u,\"g\":%u,\"b\":%u",
+                     (unsigned)solidColor.r, (unsigned)solidColor.g, (unsigned)solidColor.b);
+        if (solidColorId != LUMI_COLOR_NONE) {
+            appendStatus(status, LUMI_STATUS_JSON_SIZE, length, ",\"color\":\"%s\"", colorName());
+        }
+        appendStatus(status, LUMI_STATUS_JSON_SIZE, length, "}");
+    } else {
+        // Changed from "pal" to "palette"
+        appendStatus(status, LUMI_STATUS_JSON_SIZE, length, "\"palette\":\"%s\"", paletteName());
+    }
+
+    // Changed from "pwr" to "power"; blend_spd is a parameter name, not a command, so it stays
+    appendStatus(status, LUMI_STATUS_JSON_SIZE, length, ",\"power\":{\"v\":%u,\"ma\":%lu},\"blend_spd\":%u}",
+                 (unsigned)maxVolts, (unsigned long)maxMilliamps, (unsigned)blendSpeed);
+}
+
+LumiMemoryStats AvantLumi::getMemoryStats() {
+    LumiMemoryStats stats;
+    
+    stats.frameBufferBytes = (uint32_t)numLeds * sizeof(CRGB) * (doubleBuffered ? 2 : 1);
+    if (ditherResidual) {
+        stats.frameBufferBytes += (uint32_t)numLeds * sizeof(CRGB);
+    }
+    if (keyPrev) {
+        stats.frameBufferBytes += 2 * (uint32_t)numLeds * sizeof(CRGB);
+    }
+    stats.instanceBytes = sizeof(AvantLumi) + stats.frameBufferBytes
+                        + (xyTable ? (uint32_t)matrixWidth * matrixHeight *
+                                     (sizeof(uint16_t) + sizeof(LumiMatrixPoint)) : 0);
+    // Subsystems with their buffers, and the status text, once they were needed
+    stats.instanceBytes += (cues ? sizeof(LumiCueScheduler) + cues->getCapacity() * sizeof(LumiCue) : 0)
+                         + (timeline ? sizeof(LumiTimeline) : 0)
+                         + (pixelReceiver ? sizeof(LumiPixelReceiver) : 0)
+                         + (clockSync ? sizeof(LumiClockSync) : 0)
+                         + (audio ? sizeof(LumiAudio) + audio->getBufferBytes() : 0)
+                         + (statusText ? LUMI_STATUS_JSON_SIZE + LUMI_STATUS_SIZE : 0);
+    stats.allocations = lumiAllocations;
+    
+#if defined(ESP32)
+    stats.freeHeap = ESP.getFreeHeap();
+    stats.minFreeHeap = ESP.getMinFreeHeap();
+    stats.largestFreeBlock = ESP.getMaxAllocHeap();
+    stats.freePsram = ESP.getFreePsram();
+#elif defined(LUMI_HOST_MALLINFO)
+    // glibc arena: free bytes, the process-wide low-water mark kept by
+    // LumiMemory, and the free top chunk that new blocks are carved from
+    stats.freeHeap = lumiSampleFreeHeap();
+    stats.minFreeHeap = lumiMinFreeHeap;
+    stats.largestFreeBlock = (uint32_t)mallinfo2().keepcost;
+    stats.freePsram = 0;
+#else
+    stats.freeHeap = 0;
+    stats.minFreeHeap = 0;
+    stats.largestFreeBlock = 0;
+    stats.freePsram = 0;
+#endif
+    
+    return stats;
+}
+
+#ifdef AVANTLUMI_PROFILE
+uint32_t AvantLumi::profileNow() {
+#if defined(ESP32)
+    return ESP.getCycleCount();
+#elif defined(ARDUINO)
+    return micros();
+#else
+    return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+void AvantLumi::recordStage(LumiProfileStage stage, uint32_t elapsed) {
+    profileSamples[stage][profileHead] = elapsed;
+}
+
+String AvantLumi::getProfile() {
+    static const char* const stageNames[LUMI_STAGE_COUNT] = {
+        "brightness", "blend", "random", "render", "show", "audio"
+    };
+#if defined(ESP32)
+    String profile = "{\"unit\":\"cycles\",\"mhz\":" + String(ESP.getCpuFreqMHz());
+#elif defined(ARDUINO)
+    String profile = "{\"unit\":\"us\"";
+#else
+    String profile = "{\"unit\":\"ns\"";
+#endif
+    profile += ",\"samples\":" + String(profileCount);
+    profile += ",\"leds\":" + String(numLeds);
+    profile += String(",\"pipeline\":") + (highPrecision ? "\"16bit\"" : "\"8bit\"");
+    profile += String(",\"parallel\":") + (parallelRender ? "true" : "false");
+    profile += ",\"keyframe_ms\":" + String(keyframeInterval);
+    
+    uint32_t sorted[LUMI_PROFILE_WINDOW];
+    for (uint8_t stage = 0; stage < LUMI_STAGE_COUNT; stage++) {
+        uint32_t minVal = 0, maxVal = 0, p99 = 0;
+        uint64_t sum = 0;
+        
+        if (profileCount > 0) {
+            // Insertion sort of the window - only runs when the report is requested
+            for (uint16_t i = 0; i < profileCount; i++) {
+                uint32_t v = profileSamples[stage][i];
+                int16_t j = i - 1;
+                while (j >= 0 && sorted[j] > v) {
+                    sorted[j + 1] = sorted[j];
+                    j--;
+                }
+                sorted[j + 1] = v;
+                sum += v;
+            }
+            minVal = sorted[0];
+            maxVal = sorted[profileCount - 1];
+            p99 = sorted[(profileCount * 99 + 99) / 100 - 1];
+        }
+        
+        profile += ",\"" + String(stageNames[stage]) + "\":{";
+        profile += "\"min\":" + String(minVal);
+        profile += ",\"mean\":" + String(profileCount ? (uint32_t)(sum / profileCount) : 0);
+        profile += ",\"max\":" + String(maxVal);
+        profile += ",\"p99\":" + String(p99) + "}";
+    }
+    
+    profile += "}";
+    return profile;
+}
+#else
+String AvantLumi::getProfile() {
+    return "{\"enabled\":false}";
+}
+#endif
+
+// Private helper methods
+void AvantLumi::applySolidColor(CRGB color) {
+    markStatusDirty();
+    solidColor = color;
+    targetPalette = createSolidPalette(solidColor);
+    startPaletteTransition();
+    useSolidColor = true;
+    useRandomPalette = false;
+    currentPaletteId = LUMI_PALETTE_SOLID;
+}
+
+CRGBPalette16 AvantLumi::createSolidPalette(CRGB color) {
     return CRGBPalette16(color, color, color, color, 
                          color, color, color, color,
                          color, color, color, color,
@@ -450,7 +1797,7 @@ CRGBPalette16 AvantLumi::createSolidPalette(CRGB color) {
 }
 
 void AvantLumi::updateBrightness() {
-    unsigned long currentTime = millis();
+    unsigned long currentTime = localNow();
     
     if (currentTime - lastBrightnessUpdate >= 20) {
         lastBrightnessUpdate = currentTime;
@@ -467,159 +1814,146 @@ void AvantLumi::updateBrightness() {
         else if (actualBrightness > targetBrightness) {
             actualBrightness = max((int)actualBrightness - 3, (int)targetBrightness);
         }
-        
-        FastLED.setBrightness(actualBrightness);
     }
 }
 
-void AvantLumi::updateLEDs() {
-    random16_set_seed(535);
+bool AvantLumi::renderChunk() {
+    if (renderChunkSize == 0) {
+        renderRange(0, numLeds, FADE_SEED);
+        return true;
+    }
     
-    for (int i = 0; i < numLeds; i++) {
-        uint8_t fader;
-        
-        if (fadeinEnabled) {
-            fader = sin8(millis() / random8(10, 20));
-        } else {
-            fader = 255;
-        }
-        
-        leds[i] = ColorFromPalette(currentPalette, i * 20, fader, currentBlending);
+    // At least one chunk per call, more while the time budget lasts.
+    // A chunk continues the fade-speed sequence where the previous one stopped.
+    if (renderCursor == 0) {
+        renderSeed = FADE_SEED;
     }
+    uint32_t start = micros();
+    do {
+        uint16_t end = min((uint32_t)renderCursor + renderChunkSize, (uint32_t)numLeds);
+        renderSeed = renderRange(renderCursor, end, renderSeed);
+        renderCursor = end;
+    } while (renderCursor < numLeds && micros() - start < renderBudgetUs);
     
-    random16_set_seed(millis());
-}
-
-void AvantLumi::generateRandomPalette() {
-    uint8_t baseC = random8(255);
-    targetPalette = CRGBPalette16(CHSV(baseC + random8(0, 32), 255, random8(128, 255)), 
-                                  CHSV(baseC + random8(0, 32), 255, random8(128, 255)), 
-                                  CHSV(baseC + random8(0, 32), 192, random8(128, 255)), 
-                                  CHSV(baseC + random8(0, 32), 255, random8(128, 255)));
+    if (renderCursor < numLeds) {
+        return false;
+    }
+    renderCursor = 0;
+    return true;
 }
 
-CRGB AvantLumi::parseColorName(String colorName) {
-    colorName.toLowerCase();
+bool AvantLumi::renderInterpolated() {
+    uint32_t now = showTime();
     
-    // Basic colors
-    if (colorName == "red") return CRGB::Red;
-    else if (colorName == "green") return CRGB::Green;
-    else if (colorName == "blue") return CRGB::Blue;
-    else if (colorName == "white") return CRGB::White;
-    else if (colorName == "black") return CRGB::Black;
-    else if (colorName == "yellow") return CRGB::Yellow;
-    else if (colorName == "cyan") return CRGB::Cyan;
-    else if (colorName == "magenta") return CRGB::Magenta;
-    else if (colorName == "orange") return CRGB::Orange;
-    else if (colorName == "purple") return CRGB::Purple;
-    else if (colorName == "pink") return CRGB::Pink;
-    else if (colorName == "brown") return CRGB::Brown;
+    if (!keyframeReady || renderCursor != 0 || now - keyframeAt >= keyframeInterval) {
+        // Only keyNext is on screen by now, so the next keyframe can be drawn over keyPrev
+        CRGB* output = leds;
+        leds = keyPrev;
+        bool done = renderChunk();
+        leds = output;
+        
+        if (done) {
+            CRGB* older = keyNext;
+            keyNext = keyPrev;
+            keyPrev = older;
+            if (!keyframeReady) {
+                copyFrame(keyPrev, keyNext);
+                keyframeReady = true;
+            }
+            keyframeAt = now;
+        }
+    }
     
-    // Extended colors - Light variations
-    else if (colorName == "lightgreen") return CRGB::LightGreen;
-    else if (colorName == "lightblue") return CRGB::LightBlue;
-    else if (colorName == "lightpink") return CRGB::LightPink;
-    else if (colorName == "lightcyan") return CRGB::LightCyan;
-    else if (colorName == "lightyellow") return CRGB::LightYellow;
-    else if (colorName == "lightsteelblue") return CRGB::LightSteelBlue;
+    if (!keyframeReady) {
+        return false; // Nothing to show until the first keyframe is complete
+    }
     
-    // Extended colors - Dark variations
-    else if (colorName == "darkred") return CRGB::DarkRed;
-    else if (colorName == "darkgreen") return CRGB::DarkGreen;
-    else if (colorName == "darkblue") return CRGB::DarkBlue;
-    else if (colorName == "darkorange") return CRGB::DarkOrange;
-    else if (colorName == "darkviolet") return CRGB::DarkViolet;
-    else if (colorName == "darkgray" || colorName == "darkgrey") return CRGB::DarkGray;
-    else if (colorName == "darkcyan") return CRGB::DarkCyan;
-    else if (colorName == "darkgoldenrod") return CRGB::DarkGoldenrod;
-    else if (colorName == "darkslateblue") return CRGB::DarkSlateBlue;
-    else if (colorName == "darkturquoise") return CRGB::DarkTurquoise;
-    else if (colorName == "darkseagreen") return CRGB::DarkSeaGreen;
+    uint32_t elapsed = now - keyframeAt;
+    keyframeMix = elapsed >= keyframeInterval ? 255 : elapsed * 255 / keyframeInterval;
+    if (keyframeMix == 255) {
+        copyFrame(leds, keyNext);
+    } else {
+        blendFrame(keyframeMix);
+    }
     
-    // Extended colors - Medium variations
-    else if (colorName == "mediumblue") return CRGB::MediumBlue;
-    else if (colorName == "mediumorchid") return CRGB::MediumOrchid;
-    else if (colorName == "mediumspringgreen") return CRGB::MediumSpringGreen;
+    // Every later call produces an output frame, even while a keyframe is in progress
+    return true;
+}
+
+uint16_t AvantLumi::renderRange(uint16_t first, uint16_t last, uint16_t seed) {
+    if (parallelRender && last - first >= LUMI_PARALLEL_MIN_LEDS) {
+        // Upper half goes to the worker on the other core, starting from its own seed
+        uint16_t mid = first + (last - first) / 2;
+        uint16_t upperSeed = seed;
+        if (fadeinEnabled) {
+            for (uint16_t i = first; i < mid; i++) {
+                upperSeed = lumiFadeStep(upperSeed);
+            }
+        }
+        startWorker(mid, last, upperSeed);
+        renderSlice(first, mid, seed);
+        return joinWorker();
+    }
+    if (first == 0 && last == numLeds) {
+        return renderFrame(seed);
+    }
+    return renderSlice(first, last, seed);
+}
+
+uint16_t AvantLumi::renderSlice(uint16_t first, uint16_t last, uint16_t seed) {
+    return renderLEDs<0>(first, last, seed);
+}
+
+uint16_t AvantLumi::renderFrame(uint16_t seed) {
+    return renderLEDs<0>(0, numLeds, seed);
+}
+
+void AvantLumi::blendFrame(uint8_t mix) {
+    blendLEDs<0>(mix);
+}
+
+void AvantLumi::copyFrame(CRGB* dst, const CRGB* src) {
+    copyLEDs<0>(dst, src);
+}
+
+void AvantLumi::generateRandomPalette() {
+    // Derive the PRNG state from the shared seed and the epoch so every node picks the same colors
+    uint16_t savedSeed = random16_get_seed();
+    uint32_t mix = (currentSeed() ^ randomEpoch) * 2654435761UL;
+    random16_set_seed(mix >> 16);
     
-    // Special colors
-    else if (colorName == "springgreen") return CRGB::SpringGreen;
-    else if (colorName == "forestgreen") return CRGB::ForestGreen;
-    else if (colorName == "seagreen") return CRGB::SeaGreen;
-    else if (colorName == "limegreen") return CRGB::LimeGreen;
-    else if (colorName == "lime") return CRGB::Lime;
-    else if (colorName == "aqua") return CRGB::Aqua;
-    else if (colorName == "aquamarine") return CRGB::Aquamarine;
-    else if (colorName == "turquoise") return CRGB::Turquoise;
-    else if (colorName == "palegreen") return CRGB::PaleGreen;
-    else if (colorName == "paleturquoise") return CRGB::PaleTurquoise;
-    else if (colorName == "powderblue") return CRGB::PowderBlue;
-    else if (colorName == "steelblue") return CRGB::SteelBlue;
-    else if (colorName == "royalblue") return CRGB::RoyalBlue;
-    else if (colorName == "cornflowerblue") return CRGB::CornflowerBlue;
-    else if (colorName == "deepskyblue") return CRGB::DeepSkyBlue;
-    else if (colorName == "dodgerblue") return CRGB::DodgerBlue;
-    else if (colorName == "midnightblue") return CRGB::MidnightBlue;
-    else if (colorName == "navy") return CRGB::Navy;
-    else if (colorName == "indigo") return CRGB::Indigo;
-    else if (colorName == "violet") return CRGB::Violet;
-    else if (colorName == "fuchsia") return CRGB::Fuchsia;
-    else if (colorName == "hotpink") return CRGB::HotPink;
-    else if (colorName == "deeppink") return CRGB::DeepPink;
-    else if (colorName == "crimson") return CRGB::Crimson;
-    else if (colorName == "firebrick") return CRGB::FireBrick;
-    else if (colorName == "maroon") return CRGB::Maroon;
-    else if (colorName == "orangered") return CRGB::OrangeRed;
-    else if (colorName == "tomato") return CRGB::Tomato;
-    else if (colorName == "coral") return CRGB::Coral;
-    else if (colorName == "chocolate") return CRGB::Chocolate;
-    else if (colorName == "saddlebrown") return CRGB::SaddleBrown;
-    else if (colorName == "sienna") return CRGB::Sienna;
-    else if (colorName == "peru") return CRGB::Peru;
-    else if (colorName == "goldenrod") return CRGB::Goldenrod;
-    else if (colorName == "gold") return CRGB::Gold;
-    else if (colorName == "greenyellow") return CRGB::GreenYellow;
-    else if (colorName == "lemonchiffon") return CRGB::LemonChiffon;
-    else if (colorName == "honeydew") return CRGB::Honeydew;
-    else if (colorName == "lavender") return CRGB::Lavender;
-    else if (colorName == "thistle") return CRGB::Thistle;
-    else if (colorName == "aliceblue") return CRGB::AliceBlue;
-    else if (colorName == "gray" || colorName == "grey") return CRGB::Gray;
-    else if (colorName == "silver") return CRGB::Silver;
-    else if (colorName == "teal") return CRGB::Teal;
-    else if (colorName == "cadetblue") return CRGB::CadetBlue;
-    else if (colorName == "darkslategray" || colorName == "darkslategrey") return CRGB::DarkSlateGray;
-    else if (colorName == "indianred") return CRGB::IndianRed;
+    uint8_t baseC = random8(255);
+    targetPalette = CRGBPalette16(CHSV(baseC + random8(0, 32), 255, random8(128, 255)), 
+                                  CHSV(baseC + random8(0, 32), 255, random8(128, 255)), 
+                                  CHSV(baseC + random8(0, 32), 192, random8(128, 255)), 
+                                  CHSV(baseC + random8(0, 32), 255, random8(128, 255)));
+    random16_set_seed(savedSeed);
+    startPaletteTransition();
+    crossfadeStart = randomEpoch * 5000UL;  // Anchor the fade to the epoch boundary, not local arrival
+}
+
+CRGB AvantLumi::parseColorName(String colorName) {
+    int id = findColorId(colorName);
     
     // If color name not found, return Red as default
-    return CRGB::Red;
+    return id >= 0 ? CRGB(namedColors[id].rgb) : CRGB(CRGB::Red);
 }
 
 bool AvantLumi::isValidColorName(String colorName) {
-    colorName.toLowerCase();
-    
-    // List of all supported color names
-    String validColors[] = {
-        "red", "green", "blue", "white", "black", "yellow", "cyan", "magenta", "orange", "purple", "pink", "brown",
-        "lightgreen", "lightblue", "lightpink", "lightcyan", "lightyellow", "lightsteelblue",
-        "darkred", "darkgreen", "darkblue", "darkorange", "darkviolet", "darkgray", "darkgrey", "darkcyan", 
-        "darkgoldenrod", "darkslateblue", "darkturquoise", "darkseagreen",
-        "mediumblue", "mediumorchid", "mediumspringgreen",
-        "springgreen", "forestgreen", "seagreen", "limegreen", "lime", "aqua", "aquamarine", "turquoise",
-        "palegreen", "paleturquoise", "powderblue", "steelblue", "royalblue", "cornflowerblue", "deepskyblue",
-        "dodgerblue", "midnightblue", "navy", "indigo", "violet", "fuchsia", "hotpink", "deeppink", "crimson",
-        "firebrick", "maroon", "orangered", "tomato", "coral", "chocolate", "saddlebrown", "sienna", "peru",
-        "goldenrod", "gold", "greenyellow", "lemonchiffon", "honeydew", "lavender", "thistle", "aliceblue",
-        "gray", "grey", "silver", "teal", "cadetblue", "darkslategray", "darkslategrey", "indianred"
-    };
-    
-    int numColors = sizeof(validColors) / sizeof(validColors[0]);
-    
-    for (int i = 0; i < numColors; i++) {
-        if (colorName == validColors[i]) {
-            return true;
+    return findColorId(colorName) >= 0;
+}
+
+int AvantLumi::findColorId(String colorName) {
+    return findColorId(colorName.c_str(), colorName.length());
+}
+
+int AvantLumi::findColorId(const char* name, size_t length) {
+    for (uint8_t i = 0; i < NAMED_COLOR_COUNT; i++) {
+        if (strncasecmp(name, namedColors[i].name, length) == 0 && namedColors[i].name[length] == '\0') {
+            return i;
         }
     }
-    return false;
+    return -1;
 }
 
 bool AvantLumi::setMaxPower(uint8_t voltsVal, uint32_t milliamps) {
@@ -633,6 +1967,7 @@ bool AvantLumi::setMaxPower(uint8_t voltsVal, uint32_t milliamps) {
         return false;
     }
     
+    markStatusDirty();
     maxVolts = voltsVal;
     maxMilliamps = milliamps;
     
@@ -652,6 +1987,11 @@ uint32_t AvantLumi::getMaxMilliamps() {
 
 bool AvantLumi::setBlendSpeed(uint8_t speed_val) {
     if (speed_val >= 1 && speed_val <= 5) {
+        if (queueCommand(CMD_BLEND)) {
+            pendingBlendSpeed = speed_val;
+            return true;
+        }
+        markStatusDirty();
         blendSpeed = speed_val;
         return true;
     }
@@ -662,6 +2002,147 @@ uint8_t AvantLumi::getBlendSpeed() {
     return blendSpeed;
 }
 
+bool AvantLumi::setCrossfade(unsigned long durationMs) {
+    // 0 disables crossfading and falls back to blend-speed stepping
+    if (durationMs > 60000) {
+        return false;
+    }
+    crossfadeDuration = durationMs;
+    if (!paletteBlendComplete) {
+        startPaletteTransition();
+    }
+    return true;
+}
+
+unsigned long AvantLumi::getCrossfade() {
+    return crossfadeDuration;
+}
+
+bool AvantLumi::isBlendComplete() {
+    return paletteBlendComplete;
+}
+
+void AvantLumi::setCoalescing(bool enabled) {
+    if (!enabled && pendingFields) {
+        flushCommands();
+    }
+    coalescing = enabled;
+}
+
+bool AvantLumi::getCoalescing() {
+    return coalescing;
+}
+
+bool AvantLumi::queueCommand(uint8_t field) {
+    if (!coalescing) {
+        return false;
+    }
+    commandsReceived++;
+    pendingFields |= field;
+    noteCommand();
+    idle = false;   // Queued fields are only flushed by a drawing update()
+    return true;
+}
+
+void AvantLumi::flushCommands() {
+    // Apply through the normal setters with queueing suspended
+    uint8_t fields = pendingFields;
+    bool wasCoalescing = coalescing;
+    pendingFields = 0;
+    coalescing = false;
+    
+    if (fields & CMD_SWITCH) {
+        setSwitch(pendingSwitch);
+        commandsApplied++;
+    }
+    if (fields & CMD_BRIGHT) {
+        setBright(pendingBright);
+        commandsApplied++;
+    }
+    if (fields & CMD_FADE) {
+        setFade(pendingFade);
+        commandsApplied++;
+    }
+    if (fields & CMD_BLEND) {
+        setBlendSpeed(pendingBlendSpeed);
+        commandsApplied++;
+    }
+    if (fields & CMD_LOOK) {
+        switch (pendingLookKind) {
+            case LOOK_RGB:     setRGB(pendingRGB.r, pendingRGB.g, pendingRGB.b); break;
+            case LOOK_COLOR:   setColorId(pendingLookId);                         break;
+            case LOOK_PALETTE: setPaletteId(pendingLookId);                       break;
+        }
+        commandsApplied++;
+    }
+    
+    coalescing = wasCoalescing;
+}
+
+LumiCommandStats AvantLumi::getCommandStats() {
+    LumiCommandStats stats;
+    stats.received = commandsReceived;
+    stats.applied = commandsApplied;
+    stats.pendingFields = 0;
+    for (uint8_t bits = pendingFields; bits; bits &= bits - 1) {
+        stats.pendingFields++;
+    }
+    return stats;
+}
+
+void AvantLumi::startPaletteTransition() {
+    // Restart from whatever is currently displayed so an interrupted fade stays continuous
+    sourcePalette = currentPalette;
+    crossfadeStart = showTime();
+    blendSteps = 0;
+    paletteBlendComplete = false;
+}
+
+void AvantLumi::updatePaletteBlend() {
+    if (paletteBlendComplete) {
+        return; // Converged - leave the palette untouched
+    }
+    
+    if (crossfadeDuration > 0) {
+        // Deterministic crossfade: fraction of target derived from elapsed time
+        unsigned long elapsed = showTime() - crossfadeStart;
+        if (elapsed >= crossfadeDuration) {
+            currentPalette = targetPalette;
+            paletteBlendComplete = true;
+        } else {
+            uint8_t amount = (uint8_t)((elapsed * 255UL) / crossfadeDuration);
+            blend(sourcePalette.entries, targetPalette.entries, currentPalette.entries, 16, amount);
+        }
+        return;
+    }
+    
+    // Legacy incremental blending, stopped once the palettes match
+    unsigned long blendInterval;
+    uint8_t maxBlendChanges;
+    getBlendParameters(audioEnabled ? audioBlendSpeed : blendSpeed, blendInterval, maxBlendChanges);
+
+    if (clockSync != nullptr && clockSync->getRole() != LUMI_SYNC_OFF) {
+        // Synchronized nodes take the steps due by show time, catching up on any
+        // a slow loop missed, so all nodes have blended equally far at equal times
+        unsigned long due = (showTime() - crossfadeStart) / blendInterval;
+        while (blendSteps < due && !paletteBlendComplete) {
+            nblendPaletteTowardPalette(currentPalette, targetPalette, maxBlendChanges);
+            blendSteps++;
+            paletteBlendComplete = (currentPalette == targetPalette);
+        }
+        return;
+    }
+
+    unsigned long now = localNow();
+    if (now - lastPaletteBlend >= blendInterval) {
+        lastPaletteBlend = now;
+        nblendPaletteTowardPalette(currentPalette, targetPalette, maxBlendChanges);
+        if (currentPalette == targetPalette) {
+            paletteBlendComplete = true;
+        }
+    }
+}
+
 void AvantLumi::getBlendParameters(uint8_t speedLevel, unsigned long& interval, uint8_t& maxChanges) {
     switch(speedLevel) {
         case 1:  // Slowest
@@ -707,7 +2188,31 @@ struct LedConfig {
     uint8_t blendSpeed;  // Add this line
 };
 
+const uint8_t PRESET_MARKER = 0xA5;
+
+// One scene in the preset store - fixed size so slot N lives at a computed offset
+struct LumiPreset {
+    uint8_t marker;          // PRESET_MARKER when the slot is in use
+    uint8_t flags;           // PRESET_FLAG_*
+    uint8_t paletteId;       // LumiPaletteId or LUMI_PALETTE_SOLID
+    uint8_t colorId;         // Named color id or LUMI_COLOR_NONE
+    uint8_t brightnessLevel;
+    uint8_t blendSpeed;
+    uint8_t r, g, b;
+    char name[LUMI_PRESET_NAME_LEN];
+};
+
+const uint8_t PRESET_FLAG_SWITCH = 0x01;
+const uint8_t PRESET_FLAG_FADE   = 0x02;
+
+// EEPROM layout: LedConfig at 0, followed by LUMI_MAX_PRESETS preset slots
+const size_t PRESET_BASE = (sizeof(LedConfig) + 3) & ~(size_t)3;
+const size_t EEPROM_SIZE = PRESET_BASE + LUMI_MAX_PRESETS * sizeof(LumiPreset);
+
 bool AvantLumi::saveConfig() {
+    if (pendingFields) {
+        flushCommands(); // Save what the caller last asked for
+    }
     LedConfig config;
     config.magic = CONFIG_MAGIC;
     config.ledEnabled = this->ledEnabled;
@@ -715,42 +2220,52 @@ bool AvantLumi::saveConfig() {
     config.fadeinEnabled = this->fadeinEnabled;
     config.useSolidColor = this->useSolidColor;
     config.solidColor = this->solidColor;
-    strncpy(config.currentPaletteName, this->currentPaletteName.c_str(), sizeof(config.currentPaletteName) - 1);
+    // Names rather than ids keep configs valid if the tables are reordered
+    strncpy(config.currentPaletteName, paletteName(), sizeof(config.currentPaletteName) - 1);
     config.currentPaletteName[sizeof(config.currentPaletteName) - 1] = '\0';
-    strncpy(config.solidColorName, this->solidColorName.c_str(), sizeof(config.solidColorName) - 1);
+    strncpy(config.solidColorName, colorName(), sizeof(config.solidColorName) - 1);
     config.solidColorName[sizeof(config.solidColorName) - 1] = '\0';
     config.useRandomPalette = this->useRandomPalette;
     config.blendSpeed = this->blendSpeed;
 
-    EEPROM.begin(sizeof(LedConfig));
+    EEPROM.begin(EEPROM_SIZE);
     EEPROM.put(0, config);
     return EEPROM.commit();
 }
 
 bool AvantLumi::loadConfig() {
     LedConfig config;
-    EEPROM.begin(sizeof(LedConfig));
+    EEPROM.begin(EEPROM_SIZE);
     EEPROM.get(0, config);
 
     if (config.magic != CONFIG_MAGIC) {
         return false; // No valid config found
     }
 
+    pendingFields = 0;
+    markStatusDirty();
     this->ledEnabled = config.ledEnabled;
     this->currentBrightnessLevel = config.currentBrightnessLevel;
     this->fadeinEnabled = config.fadeinEnabled;
     this->useSolidColor = config.useSolidColor;
     this->solidColor = config.solidColor;
-    this->currentPaletteName = String(config.currentPaletteName);
-    this->solidColorName = String(config.solidColorName);
+    config.currentPaletteName[sizeof(config.currentPaletteName) - 1] = '\0';
+    config.solidColorName[sizeof(config.solidColorName) - 1] = '\0';
     this->useRandomPalette = config.useRandomPalette;
     this->blendSpeed = config.blendSpeed;
 
     // Restore palette state
     if (this->useSolidColor) {
+        int colorId = findColorId(config.solidColorName, strlen(config.solidColorName));
+        this->solidColorId = colorId >= 0 ? colorId : LUMI_COLOR_NONE;
+        this->currentPaletteId = LUMI_PALETTE_SOLID;
         this->targetPalette = createSolidPalette(this->solidColor);
+        startPaletteTransition();
     } else {
-        setPalette(this->currentPaletteName);
+        int paletteId = findPaletteId(config.currentPaletteName, strlen(config.currentPaletteName));
+        if (paletteId >= 0) {
+            setPaletteId(paletteId);
+        }
     }
 
     // Update brightness
@@ -760,8 +2275,448 @@ bool AvantLumi::loadConfig() {
 }
 
 bool AvantLumi::checkConfig() {
-    EEPROM.begin(sizeof(LedConfig));
-    uint32_t magic;
+    EEPROM.begin(EEPROM_SIZE);
+    uint32_t magic = 0;
     EEPROM.get(0, magic);
     return magic == CONFIG_MAGIC;
-}
\ No newline at end of file
+}
+bool AvantLumi::savePreset(uint8_t id, String name) {
+    if (id >= LUMI_MAX_PRESETS) {
+        return false;
+    }
+    if (pendingFields) {
+        flushCommands();
+    }
+    
+    LumiPreset preset;
+    preset.marker = PRESET_MARKER;
+    preset.flags = (ledEnabled ? PRESET_FLAG_SWITCH : 0) | (fadeinEnabled ? PRESET_FLAG_FADE : 0);
+    preset.paletteId = useSolidColor ? (uint8_t)LUMI_PALETTE_SOLID : currentPaletteId;
+    preset.colorId = useSolidColor ? solidColorId : LUMI_COLOR_NONE;
+    preset.brightnessLevel = currentBrightnessLevel;
+    preset.blendSpeed = blendSpeed;
+    preset.r = solidColor.r;
+    preset.g = solidColor.g;
+    preset.b = solidColor.b;
+    strncpy(preset.name, name.c_str(), sizeof(preset.name) - 1);
+    preset.name[sizeof(preset.name) - 1] = '\0';
+    
+    EEPROM.begin(EEPROM_SIZE);
+    EEPROM.put(PRESET_BASE + id * sizeof(LumiPreset), preset);
+    return EEPROM.commit();
+}
+
+bool AvantLumi::recallPreset(uint8_t id) {
+    if (id >= LUMI_MAX_PRESETS) {
+        return false;
+    }
+    
+    LumiPreset preset = {};
+    EEPROM.begin(EEPROM_SIZE);
+    EEPROM.get(PRESET_BASE + id * sizeof(LumiPreset), preset);
+    
+    // Everything is checked before anything changes, so a bad slot leaves the scene alone
+    if (preset.marker != PRESET_MARKER ||
+        preset.brightnessLevel < 1 || preset.brightnessLevel > 5 ||
+        preset.blendSpeed < 1 || preset.blendSpeed > 5 ||
+        (preset.paletteId >= LUMI_PALETTE_COUNT && preset.paletteId != LUMI_PALETTE_SOLID)) {
+        return false; // Empty or corrupt slot
+    }
+    
+    // Apply every field before the next update() so the scene changes in a single frame.
+    // Older queued commands would otherwise override the scene when flushed.
+    pendingFields = 0;
+    markStatusDirty();
+    ledEnabled = preset.flags & PRESET_FLAG_SWITCH;
+    fadeinEnabled = preset.flags & PRESET_FLAG_FADE;
+    currentBrightnessLevel = preset.brightnessLevel;
+    blendSpeed = preset.blendSpeed;
+    
+    if (preset.paletteId == LUMI_PALETTE_SOLID) {
+        if (setColorId(preset.colorId)) {
+            return true;
+        }
+        return setRGB(preset.r, preset.g, preset.b);
+    }
+    return setPaletteId(preset.paletteId);
+}
+
+bool AvantLumi::deletePreset(uint8_t id) {
+    if (id >= LUMI_MAX_PRESETS) {
+        return false;
+    }
+    
+    EEPROM.begin(EEPROM_SIZE);
+    EEPROM.write(PRESET_BASE + id * sizeof(LumiPreset), 0);
+    return EEPROM.commit();
+}
+
+bool AvantLumi::hasPreset(uint8_t id) {
+    if (id >= LUMI_MAX_PRESETS) {
+        return false;
+    }
+    
+    EEPROM.begin(EEPROM_SIZE);
+    return EEPROM.read(PRESET_BASE + id * sizeof(LumiPreset)) == PRESET_MARKER;
+}
+
+String AvantLumi::getPresetName(uint8_t id) {
+    if (!hasPreset(id)) {
+        return "";
+    }
+    
+    LumiPreset preset;
+    EEPROM.get(PRESET_BASE + id * sizeof(LumiPreset), preset);
+    preset.name[sizeof(preset.name) - 1] = '\0';
+    return String(preset.name);
+}
+
+int AvantLumi::findPreset(String name) {
+    for (uint8_t id = 0; id < LUMI_MAX_PRESETS; id++) {
+        if (hasPreset(id) && getPresetName(id) == name) {
+            return id;
+        }
+    }
+    return -1;
+}
+
+bool AvantLumi::ensureCues() {
+    if (cues == nullptr) {
+        cues = lumiCounted(new (std::nothrow) LumiCueScheduler());
+    }
+    return cues != nullptr;
+}
+
+bool AvantLumi::beginCues(uint16_t maxCues) {
+    return ensureCues() && cues->begin(maxCues);
+}
+
+void AvantLumi::setCueClock(LumiClockFn clockFn) {
+    if (ensureCues()) {
+        cues->setClock(clockFn);
+    }
+}
+
+int AvantLumi::addCue(uint8_t hour, uint8_t minute, uint8_t second, uint8_t days,
+                      LumiCueAction action, uint8_t value) {
+    return cues ? cues->addCue(hour, minute, second, days, action, value) : -1;
+}
+
+bool AvantLumi::removeCue(uint16_t id) {
+    return cues && cues->removeCue(id);
+}
+
+void AvantLumi::clearCues() {
+    if (cues) {
+        cues->clear();
+    }
+}
+
+uint16_t AvantLumi::getCueCount() {
+    return cues ? cues->count() : 0;
+}
+
+time_t AvantLumi::getNextCueTime() {
+    return cues ? cues->nextFireTime() : 0;
+}
+
+void AvantLumi::applyCue(const LumiCue& cue) {
+    switch (cue.action) {
+        case LUMI_CUE_SWITCH:
+            setSwitch(cue.value != 0);
+            break;
+        case LUMI_CUE_BRIGHT:
+            setBright(cue.value);
+            break;
+        case LUMI_CUE_PALETTE:
+            setPaletteId(cue.value);
+            break;
+        case LUMI_CUE_PRESET:
+            recallPreset(cue.value);
+            break;
+    }
+}
+
+bool AvantLumi::playTimeline(const char* path, bool loop) {
+    if (timeline == nullptr) {
+        timeline = lumiCounted(new (std::nothrow) LumiTimeline());
+        if (timeline == nullptr) {
+            return false;
+        }
+    }
+    if (!timeline->open(path)) {
+        return false;
+    }
+    if (loop) {
+        timeline->setLoop(true);
+    }
+    timeline->play(showTime());
+    return true;
+}
+
+void AvantLumi::stopTimeline() {
+    if (timeline) {
+        timeline->stop();
+    }
+}
+
+// State a keyframe overwrites, as CMD_* bits plus the crossfade duration
+const uint8_t KF_CROSSFADE = 0x20;
+const uint8_t KF_ALL = CMD_LOOK | CMD_BRIGHT | CMD_SWITCH | CMD_FADE | CMD_BLEND | KF_CROSSFADE;
+
+static uint8_t keyframeFields(const LumiKeyframe& kf) {
+    switch (kf.type) {
+        case LUMI_KF_SWITCH:    return CMD_SWITCH;
+        case LUMI_KF_BRIGHT:    return CMD_BRIGHT;
+        case LUMI_KF_FADE:      return CMD_FADE;
+        case LUMI_KF_BLEND:     return CMD_BLEND;
+        case LUMI_KF_PALETTE:
+        case LUMI_KF_RGB:
+        case LUMI_KF_COLOR:     return CMD_LOOK;
+        case LUMI_KF_PRESET:    return CMD_LOOK | CMD_BRIGHT | CMD_SWITCH | CMD_FADE | CMD_BLEND;
+        case LUMI_KF_CROSSFADE: return KF_CROSSFADE;
+        default:                return 0;
+    }
+}
+
+bool AvantLumi::seekTimeline(uint32_t positionMs) {
+    uint32_t index;
+    if (timeline == nullptr || !timeline->seek(positionMs, showTime(), index)) {
+        return false;
+    }
+    
+    // Rebuild the state at positionMs. Walking back from the seek point, only a
+    // keyframe that sets something no later one overwrites is kept, so at most
+    // six are applied. The walk stops once every field is set, and reads the
+    // file a chunk at a time.
+    LumiKeyframe kept[6];
+    uint8_t keptCount = 0;
+    uint8_t covered = 0;
+    LumiKeyframe kf;
+    for (uint32_t i = index; i > 0 && covered != KF_ALL && timeline->keyframeAt(i - 1, kf); i--) {
+        uint8_t fields = keyframeFields(kf);
+        if ((fields & ~covered) == 0 || (kf.type == LUMI_KF_PRESET && !hasPreset(kf.a))) {
+            continue; // Overwritten later, or an empty slot that recalls nothing
+        }
+        covered |= fields;
+        kept[keptCount++] = kf;
+    }
+    while (keptCount > 0) {
+        applyKeyframe(kept[--keptCount]);
+    }
+    return true;
+}
+
+bool AvantLumi::isTimelinePlaying() {
+    return timeline && timeline->isPlaying();
+}
+
+uint32_t AvantLumi::getTimelinePosition() {
+    return timeline ? timeline->getPosition(showTime()) : 0;
+}
+
+void AvantLumi::applyKeyframe(const LumiKeyframe& kf) {
+    switch (kf.type) {
+        case LUMI_KF_SWITCH:
+            setSwitch(kf.a != 0);
+            break;
+        case LUMI_KF_BRIGHT:
+            setBright(kf.a);
+            break;
+        case LUMI_KF_FADE:
+            setFade(kf.a != 0);
+            break;
+        case LUMI_KF_BLEND:
+            setBlendSpeed(kf.a);
+            break;
+        case LUMI_KF_PALETTE:
+            setPaletteId(kf.a);
+            break;
+        case LUMI_KF_RGB:
+            setRGB(kf.a, kf.b, kf.c);
+            break;
+        case LUMI_KF_COLOR:
+            setColorId(kf.a);
+            break;
+        case LUMI_KF_PRESET:
+            recallPreset(kf.a);
+            break;
+        case LUMI_KF_CROSSFADE:
+            setCrossfade(kf.a | ((uint16_t)kf.b << 8));
+            break;
+    }
+}
+
+bool AvantLumi::beginPixelStream(UDP& udp, LumiStreamProtocol protocol, uint16_t port, uint16_t startUniverse) {
+    static_assert(sizeof(CRGB) == 3, "Pixel stream expects packed RGB frame buffer");
+    
+    if (leds == nullptr) {
+        return false;
+    }
+    if (pixelReceiver == nullptr) {
+        pixelReceiver = lumiCounted(new (std::nothrow) LumiPixelReceiver());
+        if (pixelReceiver == nullptr) {
+            return false;
+        }
+    }
+    if (!pixelReceiver->begin(udp, protocol, port, startUniverse)) {
+        return false;
+    }
+    pixelStreamEnabled = true;
+    return true;
+}
+
+void AvantLumi::endPixelStream() {
+    if (pixelReceiver) {
+        pixelReceiver->end();
+    }
+    pixelStreamEnabled = false;
+    externalFrame = false;
+    idle = false;
+}
+
+bool AvantLumi::isExternalFrame() {
+    return externalFrame;
+}
+
+LumiStreamStats AvantLumi::getStreamStats() {
+    if (pixelReceiver == nullptr) {
+        LumiStreamStats none = {};
+        return none;
+    }
+    return pixelReceiver->getStats();
+}
+
+bool AvantLumi::beginSync(UDP& udp, LumiSyncRole role, uint16_t port) {
+    if (clockSync == nullptr) {
+        clockSync = lumiCounted(new (std::nothrow) LumiClockSync());
+        if (clockSync == nullptr) {
+            return false;
+        }
+        clockSync->setLocalClock(localClock);
+        clockSync->setSeed(showSeed);
+    }
+    return clockSync->begin(udp, role, port);
+}
+
+void AvantLumi::endSync() {
+    // The clock object stays, so show time keeps its last offset
+    if (clockSync) {
+        clockSync->end();
+    }
+}
+
+void AvantLumi::setSyncClock(LumiMillisFn clockFn) {
+    localClock = clockFn ? clockFn : defaultMillis;
+    if (clockSync) {
+        clockSync->setLocalClock(localClock);
+    }
+}
+
+void AvantLumi::setShowSeed(uint32_t seed) {
+    showSeed = seed;
+    if (clockSync) {
+        clockSync->setSeed(seed);
+    }
+}
+
+bool AvantLumi::isSynced() {
+    return clockSync && clockSync->isSynced();
+}
+
+uint32_t AvantLumi::showTime() {
+    return clockSync ? clockSync->now() : localClock();
+}
+
+uint32_t AvantLumi::localNow() {
+    return localClock();
+}
+
+uint32_t AvantLumi::currentSeed() {
+    // Followers adopt the master's seed
+    return clockSync ? clockSync->getSeed() : showSeed;
+}
+
+void AvantLumi::setFrameCallback(LumiFrameFn fn) {
+    frameCallback = fn;
+}
+
+uint32_t AvantLumi::getFrameCount() {
+    return frameCount;
+}
+
+uint32_t AvantLumi::frameHash(const CRGB* frame, uint16_t count, uint8_t brightness) {
+    // FNV-1a over the pixel bytes followed by the brightness
+    uint32_t hash = 2166136261UL;
+    const uint8_t* bytes = (const uint8_t*)frame;
+    for (uint32_t i = 0; i < (uint32_t)count * sizeof(CRGB); i++) {
+        hash = (hash ^ bytes[i]) * 16777619UL;
+    }
+    return (hash ^ brightness) * 16777619UL;
+}
+
+bool AvantLumi::beginAudio(LumiAudioSource& source) {
+    if (audio == nullptr) {
+        audio = lumiCounted(new (std::nothrow) LumiAudio());
+        if (audio == nullptr) {
+            return false;
+        }
+    }
+    if (!audio->begin(source)) {
+        endAudio();
+        return false;
+    }
+    audioEnabled = true;
+    idle = false;
+    return true;
+}
+
+void AvantLumi::endAudio() {
+    delete audio;
+    audio = nullptr;
+    audioEnabled = false;
+    audioIndexOffset = 0;
+    audioScale = 255;
+    idle = false;
+}
+
+bool AvantLumi::isAudioActive() {
+    return audioEnabled && audio->isActive(millis());
+}
+
+LumiAudioLevels AvantLumi::getAudioLevels() {
+    if (audio == nullptr) {
+        LumiAudioLevels silent = {};
+        return silent;
+    }
+    return audio->getLevels();
+}
+
+void AvantLumi::updateAudio() {
+    uint32_t now = millis();
+    
+    if (audio->poll(now)) {
+        const LumiAudioLevels& levels = audio->getLevels();
+        
+        // Loudness sets the brightness; a beat flashes to full and decays over a few blocks
+        uint8_t target = 64 + scale8(levels.level, 191);
+        if (levels.beat) {
+            audioScale = 255;
+        } else {
+            audioScale = max(target, (uint8_t)(audioScale > 24 ? audioScale - 24 : 0));
+        }
+        
+        // Mid bands push the pattern along the strip; a beat jumps it
+        audioIndexOffset += (levels.bands[3] + levels.bands[4]) >> 6;
+        if (levels.beat) {
+            audioIndexOffset += 32;
+        }
+        
+        // Louder passages blend palettes faster
+        audioBlendSpeed = 1 + (levels.level * 4) / 255;
+    } else if (!audio->isActive(now)) {
+        // Source went quiet - render as if audio mode were off, keeping the pattern position
+        audioScale = 255;
+        audioBlendSpeed = blendSpeed;
+    }
+}
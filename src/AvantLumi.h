@@ -15,30 +15,221 @@
 
 #include "FastLED.h"
 #include <EEPROM.h>
+#include "LumiCueScheduler.h"
+#include "LumiTimeline.h"
+#include "LumiPixelReceiver.h"
+#include "LumiClockSync.h"
+#include "LumiJson.h"
+
+// Audio-reactive mode is opt-in: include LumiAudio.h (or LumiI2SSource.h on
+// ESP32) in the sketch to get a source to pass to beginAudio()
+class LumiAudio;
+class LumiAudioSource;
+struct LumiAudioLevels;
+
+#if defined(AVANTLUMI_PROFILE) && !defined(ARDUINO)
+#include <chrono>
+#endif
+
+#if defined(ESP32)
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#if portNUM_PROCESSORS > 1
+#define LUMI_PARALLEL_FREERTOS
+#endif
+#elif !defined(ARDUINO)
+// Host builds render in parallel with a worker thread and transmit from a show thread
+#include <pthread.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#define LUMI_PARALLEL_THREADS
+#endif
 
 #if FASTLED_VERSION < 3001000
 #error "Requires FastLED 3.1 or later; check github for latest code."
 #endif
 
+// Frame buffer placement
+enum LumiBufferType {
+    LUMI_BUFFER_INTERNAL,   // Internal heap (default)
+    LUMI_BUFFER_PSRAM,      // External PSRAM (ESP32 boards with PSRAM)
+    LUMI_BUFFER_EXTERNAL    // Caller-provided buffer
+};
+
+// Palette ids accepted by setPaletteId(); names map onto these in setPalette()
+enum LumiPaletteId {
+    LUMI_PALETTE_RAINBOW,
+    LUMI_PALETTE_PARTY,
+    LUMI_PALETTE_OCEAN,
+    LUMI_PALETTE_FOREST,
+    LUMI_PALETTE_HEAT,
+    LUMI_PALETTE_CLOUD,
+    LUMI_PALETTE_LAVA,
+    LUMI_PALETTE_CHRISTMAS,   // u01
+    LUMI_PALETTE_AUTUMN,      // u02
+    LUMI_PALETTE_CYBERPUNK,   // u03
+    LUMI_PALETTE_HALLOWEEN,   // u04
+    LUMI_PALETTE_WINTER,      // u05
+    LUMI_PALETTE_SPRING,      // u06
+    LUMI_PALETTE_SUNSET,      // u07
+    LUMI_PALETTE_DEEP_OCEAN,  // u08
+    LUMI_PALETTE_NEON,        // u09
+    LUMI_PALETTE_FIRE,        // u10
+    LUMI_PALETTE_RANDOM,
+    LUMI_PALETTE_COUNT,
+    LUMI_PALETTE_SOLID = 0xFE // Solid color set via setRGB()/setColor()
+};
+
+// Matrix layouts for setMatrix(), combined with |
+#define LUMI_MATRIX_ROWS 0x00              // Wired row by row, top-left first
+#define LUMI_MATRIX_COLUMNS 0x01           // Wired column by column
+#define LUMI_MATRIX_SERPENTINE 0x02        // Every other row (or column) runs backwards
+#define LUMI_MATRIX_PANEL_SERPENTINE 0x04  // Every other row of panels runs backwards
+#define LUMI_XY_NONE 0xFFFF                // XY() result outside the matrix
+
+// Palette mapping used by update() on a matrix
+enum LumiMatrixEffect {
+    LUMI_MATRIX_STRIP,      // Along the wiring, as on a plain strip
+    LUMI_MATRIX_LINEAR,     // Gradient scrolling left to right
+    LUMI_MATRIX_RADIAL,     // Rings moving out from the center
+    LUMI_MATRIX_PLASMA      // Interfering sine waves
+};
+
+// Per-LED matrix position, precomputed by setMatrix()/begin()
+struct LumiMatrixPoint {
+    uint8_t x;
+    uint8_t y;
+    uint8_t radius;     // Distance from the center, 0-255
+    uint8_t along;      // x scaled to 0-255 across the width
+};
+
+#define LUMI_COLOR_NONE 0xFF      // Solid color set from RGB rather than by name
+
+// Preset store size - override with a build flag if needed
+#ifndef LUMI_MAX_PRESETS
+#define LUMI_MAX_PRESETS 32
+#endif
+#define LUMI_PRESET_NAME_LEN 15
+
+// Memory usage snapshot returned by getMemoryStats()
+struct LumiMemoryStats {
+    uint32_t instanceBytes;     // sizeof(AvantLumi) + every heap block the instance owns
+    uint32_t frameBufferBytes;  // All frame buffers owned or used by the instance
+    uint32_t allocations;       // Heap allocations made by the library since boot
+    uint32_t freeHeap;          // Free internal heap
+    uint32_t minFreeHeap;       // Low-water mark of the internal heap, for the whole process
+    uint32_t largestFreeBlock;  // Largest allocatable block - fragmentation indicator
+    uint32_t freePsram;
+};
+
+// Command queue counters returned by getCommandStats()
+struct LumiCommandStats {
+    uint32_t received;          // Setter calls queued while coalescing
+    uint32_t applied;           // Values actually applied at frame start
+    uint8_t pendingFields;      // Fields waiting for the next update()
+};
+
+// Outcome of applyCommand()
+enum LumiCommandError {
+    LUMI_CMD_OK,
+    LUMI_CMD_SYNTAX,            // Not a well-formed JSON object; nothing applied
+    LUMI_CMD_UNKNOWN_FIELD,
+    LUMI_CMD_BAD_VALUE          // Wrong type or rejected by the setter
+};
+
+struct LumiCommandResult {
+    LumiCommandError error;
+    uint16_t offset;            // Position of the problem in the input
+    uint8_t applied;            // Fields applied, in order, before stopping
+    const char* field;          // Offending key inside the input (not terminated)
+    uint8_t fieldLength;
+};
+
+// Command-to-photon latency histogram returned by getLatencyStats()
+#define LUMI_LATENCY_BUCKETS 10   // <1, <2, <4 ... <256 ms, then 256 ms and over
+#define LUMI_STATUS_LIVE_MS 1000  // getStatusText() refreshes its live figures at most this often
+#define LUMI_STATUS_JSON_SIZE 160 // State-only status; 151 bytes at most with its terminator
+#define LUMI_STATUS_SIZE 512      // getStatusText() text; 496 bytes at most with every figure at 10 digits
+
+struct LumiLatencyStats {
+    uint32_t count;
+    uint32_t minUs;
+    uint32_t meanUs;
+    uint32_t maxUs;
+    uint32_t buckets[LUMI_LATENCY_BUCKETS];
+};
+
+#define LUMI_IDLE_FOREVER 0xFFFFFFFFUL   // getIdleSleepMs(): nothing scheduled
+#define LUMI_IDLE_POLL_MS 20              // Sleep limit while sockets or a timeline need polling
+#define LUMI_NO_PIN 0xFF
+
+#define LUMI_PARALLEL_MIN_LEDS 256   // Shorter ranges are not worth splitting
+
+// Receives every frame just before it is shown, with the brightness it is shown at
+typedef void (*LumiFrameFn)(const CRGB* frame, uint16_t count, uint8_t brightness);
+
+// Stages of update() measured when built with -DAVANTLUMI_PROFILE
+enum LumiProfileStage {
+    LUMI_STAGE_BRIGHTNESS,
+    LUMI_STAGE_BLEND,
+    LUMI_STAGE_RANDOM,
+    LUMI_STAGE_RENDER,
+    LUMI_STAGE_SHOW,
+    LUMI_STAGE_AUDIO,
+    LUMI_STAGE_COUNT
+};
+
+#define LUMI_PROFILE_WINDOW 128   // Samples kept per stage
+
 class AvantLumi {
 private:
     // LED configuration
-    CRGB* leds;
+    CRGB* leds;              // Render target - always safe to write
+    CRGB* primaryBuffer;     // Buffer supplied or allocated at construction
+    LumiBufferType bufferType;
+    bool ownsBuffer;
     uint8_t dataPin;
     uint16_t numLeds;
     
-    // State variables
-    bool fadeinEnabled;
-    bool useRandomPalette;
-    bool useSolidColor;
+    // Double buffering: frontBuffer is owned by the transmitter while a frame is in flight
+    bool doubleBuffered;
+    CRGB* frontBuffer;
+    uint8_t frontBrightness;      // Scale the front buffer is sent with, captured at commit
+#if defined(ESP32)
+    TaskHandle_t showTaskHandle;
+    SemaphoreHandle_t showDone;   // Fence: given when the front buffer is free again
+    static void showTask(void* arg);
+#elif defined(LUMI_PARALLEL_THREADS)
+    // Stands in for the show task; a plain pthread, so like the task it takes
+    // no block from the heap the library accounts for
+    pthread_t showThread;
+    std::mutex showMutex;
+    std::condition_variable showCv;
+    bool showBusy;                // Fence: set while the front buffer is being transmitted
+    bool showStop;
+    static void* showThreadLoop(void* arg);
+#endif
+    
+    // 16-bit render path: per-channel remainders carried into the next frame
+    bool highPrecision;
+    CRGB* ditherResidual;
+    
+    // State variables, widest first so nothing is padded. Palette and color are
+    // kept as ids; their names are looked up only for status and config.
+    unsigned long lastBrightnessUpdate;
+    unsigned long lastPaletteBlend;
     CRGB solidColor;
-    bool ledEnabled;
     uint8_t currentBrightnessLevel;
     uint8_t targetBrightness;
     uint8_t actualBrightness;
-    unsigned long lastBrightnessUpdate;
-    String currentPaletteName;
-    String solidColorName;
+    uint8_t currentPaletteId;     // LumiPaletteId
+    uint8_t solidColorId;         // Index into the named color table, or LUMI_COLOR_NONE
+    bool fadeinEnabled : 1;
+    bool useRandomPalette : 1;
+    bool useSolidColor : 1;
+    bool ledEnabled : 1;
     
     // Brightness levels (0-5)
     static const uint8_t brightnessLevels[6];
@@ -49,6 +240,13 @@ private:
     CRGBPalette16 targetPalette;
     TBlendType currentBlending;
     
+    // Palette transition state
+    CRGBPalette16 sourcePalette;       // Snapshot taken when a crossfade starts
+    unsigned long crossfadeDuration;   // 0 = legacy incremental blending
+    unsigned long crossfadeStart;
+    uint16_t blendSteps;               // Legacy steps taken since crossfadeStart, while synced
+    bool paletteBlendComplete;
+    
     // Custom palette definitions
     static const CRGBPalette16 christmas_p;
     static const CRGBPalette16 autumn_p;
@@ -62,30 +260,248 @@ private:
     static const CRGBPalette16 fire_p;
     
     // Private helper methods
+    void initDefaults();
+    CRGB* allocateBuffer(uint16_t count);
     CRGBPalette16 createSolidPalette(CRGB color);
+    void applySolidColor(CRGB color);
     void updateBrightness();
-    void updateLEDs();
+    bool renderChunk();
+    uint16_t renderRange(uint16_t first, uint16_t last, uint16_t seed);
+    uint16_t renderSlice(uint16_t first, uint16_t last, uint16_t seed);
     CRGB parseColorName(String colorName);
     bool isValidColorName(String colorName);
+    int findColorId(String colorName);
+    const char* colorName();
+    const char* paletteName();
+    int findColorId(const char* name, size_t length);
+    int findPaletteId(const String& paletteName);
+    int findPaletteId(const char* name, size_t length);
+    LumiCommandError applyField(const LumiJsonToken& key, const LumiJsonToken& value);
     void generateRandomPalette();
     void getBlendParameters(uint8_t speedLevel, unsigned long& interval, uint8_t& maxChanges);
+    void startPaletteTransition();
+    void updatePaletteBlend();
+    void commitFrame();
+    void waitForShow();
 
-    uint8_t maxVolts;
     uint32_t maxMilliamps;
+    uint8_t maxVolts;
+    
+    // Optional subsystems are created on first use and live until the
+    // controller is destroyed; a plain strip pays one pointer for each.
+    
+    // Time-of-day cues, checked once per update()
+    LumiCueScheduler* cues;
+    bool ensureCues();
+    void applyCue(const LumiCue& cue);
+    
+    // Pre-authored show playback
+    LumiTimeline* timeline;
+    void applyKeyframe(const LumiKeyframe& kf);
+    
+    // External frames streamed over UDP replace updateLEDs() while active
+    LumiPixelReceiver* pixelReceiver;
+    bool pixelStreamEnabled;
+    bool externalFrame;
+    
+    // Shared show clock: effects, random palettes and timelines run on it.
+    // Without beginSync() show time is the local clock and the seed is local.
+    LumiClockSync* clockSync;
+    LumiMillisFn localClock;
+    uint32_t showSeed;
+    uint32_t randomEpoch;       // showTime() / 5000 of the last random palette
+    uint32_t localNow();
+    uint32_t currentSeed();
+    
+    // Audio-reactive mode: analysis results mapped onto the render each frame.
+    // The analyzer and its FFT buffers only exist between beginAudio() and endAudio().
+    LumiAudio* audio;
+    bool audioEnabled;
+    uint8_t audioIndexOffset;   // Added to the palette index of every LED
+    uint8_t audioScale;         // Extra brightness scale for the fade value
+    uint8_t audioBlendSpeed;    // Replaces blendSpeed while audio is active
+    void updateAudio();
+    
+    // Command-to-photon latency: oldest change made outside update() not yet shown
+    uint32_t commandSince;      // micros() at ingress, 0 = nothing pending
+    bool inUpdate;
+    LumiLatencyStats latency;
+    uint64_t latencySum;
+    void noteCommand();
+    void recordLatency();
+    
+    // Matrix layout: XY lookup table and its inverse, built once
+    uint8_t matrixWidth;
+    uint8_t matrixHeight;
+    uint8_t matrixLayout;
+    uint8_t panelWidth;
+    uint8_t panelHeight;
+    uint16_t* xyTable;          // (y * width + x) -> LED index
+    LumiMatrixPoint* matrixPoints;  // LED index -> position
+    LumiMatrixEffect matrixEffect;
+    bool buildMatrix();
+    void freeMatrix();
+    uint8_t paletteIndex(uint16_t i, uint32_t now);
+    
+    // Parallel rendering: the upper half of each range is drawn by a worker on the other core
+    bool parallelRender;
+    uint16_t workerFirst;
+    uint16_t workerLast;
+    uint16_t workerSeed;        // Fade seed at workerFirst in, at workerLast out
+#if defined(LUMI_PARALLEL_FREERTOS)
+    TaskHandle_t renderTaskHandle;
+    SemaphoreHandle_t renderDone;
+    static void renderTask(void* arg);
+#elif defined(LUMI_PARALLEL_THREADS)
+    std::thread renderThread;
+    std::mutex renderMutex;
+    std::condition_variable renderCv;
+    bool renderJob;
+    bool renderStop;
+    void renderThreadLoop();
+#endif
+    void startWorker(uint16_t first, uint16_t last, uint16_t seed);
+    uint16_t joinWorker();
+    
+    // Frame interpolation: the effect is drawn into keyframes at a lower rate and
+    // every update() in between outputs a blend of the last two
+    uint16_t keyframeInterval;  // ms, 0 = off
+    CRGB* keyPrev;              // Older keyframe; the next one is drawn over it
+    CRGB* keyNext;
+    uint32_t keyframeAt;        // Show time the newer keyframe was completed
+    uint8_t keyframeMix;        // Share of keyNext in the last output, 255 = settled
+    bool keyframeReady;         // Both keyframes hold valid frames
+    bool renderInterpolated();
+    
+    // Chunked rendering: a frame may be drawn over several update() calls
+    uint16_t renderChunkSize;   // 0 = whole frame per call
+    uint32_t renderBudgetUs;
+    uint16_t renderCursor;      // Next LED to draw, 0 = start a new frame
+    uint16_t renderSeed;        // Fade seed where the previous chunk stopped
+    uint32_t frameTime;         // Show time the current frame is drawn for
+    
+    // Idle state: rendering and show() stop once the output is dark or unchanging
+    unsigned long powerOnAt;
+    uint16_t powerSettleMs;
+    uint8_t powerPin;           // Strip PSU enable, LUMI_NO_PIN if unused
+    bool idle : 1;
+    bool powerActiveHigh : 1;
+    bool powerOn : 1;
+    void setPower(bool on);
+    
+    // Frame capture
+    LumiFrameFn frameCallback;
+    uint32_t frameCount;
+    
+    // Command coalescing: setters store the latest value per field, update() applies it once
+    uint32_t commandsReceived;
+    uint32_t commandsApplied;
+    CRGB pendingRGB;
+    uint8_t pendingFields;      // CMD_* bits
+    uint8_t pendingLookKind;    // Solid RGB, named color or palette - one slot, last writer wins
+    uint8_t pendingLookId;
+    uint8_t pendingBright;
+    uint8_t pendingBlendSpeed;
+    bool coalescing : 1;
+    bool pendingSwitch : 1;
+    bool pendingFade : 1;
+    bool queueCommand(uint8_t field);
+    
+    // Status JSON cache, invalidated by every setter. One fixed buffer, allocated
+    // on first use: the state JSON, then getStatusText() with the live figures.
+    char* statusText;
+    uint16_t statusLength;
+    bool statusDirty;
+    uint32_t statusVersion;
+    uint32_t statusSerializations;
+    void markStatusDirty();
+    void buildStatus();
+    
+    // getStatusText(): the state JSON plus live figures, refreshed at most once a second
+    uint32_t statusLiveVersion;
+    unsigned long statusLiveAt;
+
+#ifdef AVANTLUMI_PROFILE
+    // Rolling window of per-stage durations
+    uint32_t profileSamples[LUMI_STAGE_COUNT][LUMI_PROFILE_WINDOW];
+    uint16_t profileHead;
+    uint16_t profileCount;
+    static uint32_t profileNow();
+    void recordStage(LumiProfileStage stage, uint32_t elapsed);
+#endif
+
+protected:
+    // Registers the strip with FastLED; AvantLumiT replaces the runtime pin switch
+    CLEDController* controller;
+    virtual bool addController(CRGB* output);
+    
+    // Whole-frame loops. AvantLumiT overrides these with instances whose LED
+    // count is a compile-time constant; here they run to numLeds.
+    virtual uint16_t renderFrame(uint16_t seed);
+    virtual void blendFrame(uint8_t mix);
+    virtual void copyFrame(CRGB* dst, const CRGB* src);
+    
+    // Per-LED loop bodies shared by both. COUNT = 0 draws first..last,
+    // any other COUNT draws LEDs 0..COUNT-1 with a bound the compiler can see.
+    // renderLEDs() picks the loop once per frame; FADE and AUDIO are fixed per
+    // instance, so the loops carry no per-LED option checks.
+    template<uint16_t COUNT> uint16_t renderLEDs(uint16_t first, uint16_t last, uint16_t seed);
+    template<uint16_t COUNT, bool FADE, bool AUDIO> uint16_t updateLEDs(uint16_t first, uint16_t last, uint16_t seed);
+    template<uint16_t COUNT, bool FADE, bool AUDIO> uint16_t updateLEDsHighPrecision(uint16_t first, uint16_t last, uint16_t seed);
+    template<uint16_t COUNT> void blendLEDs(uint8_t mix);
+    template<uint16_t COUNT> void copyLEDs(CRGB* dst, const CRGB* src);
 
 public:
-    // Constructor
+    // Constructors
     AvantLumi(uint8_t dataPin, uint16_t numLeds);
+    AvantLumi(uint8_t dataPin, uint16_t numLeds, LumiBufferType bufferType);
+    AvantLumi(uint8_t dataPin, uint16_t numLeds, CRGB* buffer);
     
     // Destructor
-    ~AvantLumi();
+    virtual ~AvantLumi();
     
     // Initialization
     bool begin();
+    bool hasBuffer();
     
     // Main update loop (call this in Arduino loop())
     void update();
     
+    // Double-buffered output (render next frame while the current one is sent)
+    bool setDoubleBuffer(bool enabled);
+    bool getDoubleBuffer();
+    
+    // 16-bit color math with temporal dithering for smooth low-brightness output
+    bool setHighPrecision(bool enabled);
+    bool getHighPrecision();
+    
+    // 2D matrices and panels
+    bool setMatrix(uint8_t width, uint8_t height, uint8_t layout = LUMI_MATRIX_ROWS,
+                   uint8_t panelW = 0, uint8_t panelH = 0);
+    uint16_t XY(uint8_t x, uint8_t y);
+    bool setMatrixEffect(LumiMatrixEffect effect);
+    LumiMatrixEffect getMatrixEffect();
+    uint8_t getMatrixWidth();
+    uint8_t getMatrixHeight();
+    
+    // Split rendering across both cores (ESP32 dual-core, or a thread on a PC)
+    bool setParallelRender(bool enabled);
+    bool getParallelRender();
+    
+    // Chunked rendering for very long strips (0 = render whole frames)
+    bool setChunkedRender(uint16_t chunkLeds, uint32_t budgetUs = 2000);
+    uint16_t getChunkSize();
+    
+    // Evaluate the effect every keyframeMs and blend between keyframes on every update()
+    bool setInterpolation(uint16_t keyframeMs);
+    uint16_t getInterpolation();
+    
+    // Idle / low power
+    bool isIdle();
+    uint32_t getIdleSleepMs();    // How long the caller may sleep before the next update()
+    bool setPowerPin(uint8_t pin, bool activeHigh = true, uint16_t settleMs = 50);
+    bool getPowerState();
+    
     // Setter methods
     bool setRGB(uint8_t rVal, uint8_t gVal, uint8_t bVal);
     bool setColor(String colorName);
@@ -95,7 +511,25 @@ public:
     bool setFade(String state);
     bool setFade(bool state);
     bool setPalette(String paletteName);
+    bool setPaletteId(uint8_t id);
+    bool setColorId(uint8_t id);
     bool setBlendSpeed(uint8_t speed_val);
+    bool setCrossfade(unsigned long durationMs);
+    
+    // Frame capture, e.g. for comparing output against recorded hashes
+    void setFrameCallback(LumiFrameFn fn);
+    uint32_t getFrameCount();
+    static uint32_t frameHash(const CRGB* frame, uint16_t count, uint8_t brightness);
+    
+    // Command coalescing (apply only the latest value per field once per frame)
+    void setCoalescing(bool enabled);
+    bool getCoalescing();
+    void flushCommands();
+    LumiCommandStats getCommandStats();
+    
+    // JSON commands, e.g. {"bright":3,"palette":"ocean","rgb":[255,0,0]}
+    LumiCommandResult applyCommand(const char* json, size_t length);
+    static const char* commandErrorText(LumiCommandError error);
     
     // Getter methods
     CRGB getRGB();
@@ -104,8 +538,19 @@ public:
     bool getSwitch();
     bool getFade();
     String getPalette();
-    String getStatus();
+    uint8_t getPaletteId();
+    String getStatus();                 // Copy of getStatusText(), as in earlier versions
+    const char* getStatusText();        // State plus live memory and latency figures
+    const char* getStatusJson();        // Cached state-only status, no live figures
+    uint32_t getStatusVersion();        // Increments on every state change
+    uint32_t getStatusSerializations();
+    LumiMemoryStats getMemoryStats();
+    LumiLatencyStats getLatencyStats();
+    void resetLatencyStats();
+    String getProfile();
     uint8_t getBlendSpeed();
+    unsigned long getCrossfade();
+    bool isBlendComplete();
 
     bool setMaxPower(uint8_t voltsVal, uint32_t milliamps);
     uint8_t getMaxVolts();
@@ -115,6 +560,217 @@ public:
     bool saveConfig();
     bool loadConfig();
     bool checkConfig();
+    
+    // Preset (scene) store
+    bool savePreset(uint8_t id, String name = "");
+    bool recallPreset(uint8_t id);
+    bool deletePreset(uint8_t id);
+    bool hasPreset(uint8_t id);
+    String getPresetName(uint8_t id);
+    int findPreset(String name);
+    
+    // Cue scheduler
+    bool beginCues(uint16_t maxCues);
+    void setCueClock(LumiClockFn clockFn);
+    int addCue(uint8_t hour, uint8_t minute, uint8_t second, uint8_t days,
+               LumiCueAction action, uint8_t value);
+    bool removeCue(uint16_t id);
+    void clearCues();
+    uint16_t getCueCount();
+    time_t getNextCueTime();
+    
+    // Show timeline playback (LittleFS on ESP32)
+    bool playTimeline(const char* path, bool loop = false);
+    void stopTimeline();
+    bool seekTimeline(uint32_t positionMs);
+    bool isTimelinePlaying();
+    uint32_t getTimelinePosition();
+    
+    // Raw pixel stream ingest (DDP / E1.31)
+    bool beginPixelStream(UDP& udp, LumiStreamProtocol protocol = LUMI_STREAM_DDP,
+                          uint16_t port = 0, uint16_t startUniverse = 1);
+    void endPixelStream();
+    bool isExternalFrame();
+    LumiStreamStats getStreamStats();
+    
+    // Cross-node clock sync
+    bool beginSync(UDP& udp, LumiSyncRole role, uint16_t port = LUMI_SYNC_PORT);
+    void endSync();
+    void setSyncClock(LumiMillisFn clockFn);    // Also times brightness ramps and blending
+    void setShowSeed(uint32_t seed);
+    bool isSynced();
+    uint32_t showTime();
+    
+    // Audio-reactive mode (LumiI2SSource on ESP32, LumiWavSource on a PC)
+    bool beginAudio(LumiAudioSource& source);
+    void endAudio();
+    bool isAudioActive();
+    LumiAudioLevels getAudioLevels();
+};
+
+// Per-LED fade speeds come from FastLED's random8(10, 20) sequence seeded with 535.
+// The same generator is stepped on a local state so any range of LEDs can be
+// rendered independently (chunks, or both cores at once) with identical results.
+static inline uint16_t lumiFadeStep(uint16_t seed) {
+    return seed * 2053 + 13849;   // FastLED random16 LCG
+}
+
+static inline uint8_t lumiFadeDivisor(uint16_t& seed) {
+    seed = lumiFadeStep(seed);
+    uint8_t r = (uint8_t)(seed & 0xFF) + (uint8_t)(seed >> 8);
+    return 10 + ((r * 10) >> 8);  // random8(10, 20)
+}
+
+// The render loops live in the header so AvantLumiT can instantiate them
+// with its LED count
+inline uint8_t AvantLumi::paletteIndex(uint16_t i, uint32_t now) {
+    if (matrixPoints == nullptr || matrixEffect == LUMI_MATRIX_STRIP ||
+        i >= (uint16_t)matrixWidth * matrixHeight) {
+        return i * 20;
+    }
+    
+    const LumiMatrixPoint& p = matrixPoints[i];
+    uint8_t t = now >> 4;   // One palette step every 16ms
+    switch (matrixEffect) {
+        case LUMI_MATRIX_LINEAR:
+            return p.along - t;
+        case LUMI_MATRIX_RADIAL:
+            return p.radius - t;
+        case LUMI_MATRIX_PLASMA:
+            return ((uint16_t)sin8(p.x * 16 + t) + sin8(p.y * 16 + (t >> 1)) +
+                    sin8((p.x + p.y) * 8 - t)) / 3;
+        default:
+            return i * 20;
+    }
+}
+
+template<uint16_t COUNT>
+uint16_t AvantLumi::renderLEDs(uint16_t first, uint16_t last, uint16_t seed) {
+    switch ((highPrecision ? 4 : 0) | (fadeinEnabled ? 2 : 0) | (audioEnabled ? 1 : 0)) {
+        case 0: return updateLEDs<COUNT, false, false>(first, last, seed);
+        case 1: return updateLEDs<COUNT, false, true>(first, last, seed);
+        case 2: return updateLEDs<COUNT, true, false>(first, last, seed);
+        case 3: return updateLEDs<COUNT, true, true>(first, last, seed);
+        case 4: return updateLEDsHighPrecision<COUNT, false, false>(first, last, seed);
+        case 5: return updateLEDsHighPrecision<COUNT, false, true>(first, last, seed);
+        case 6: return updateLEDsHighPrecision<COUNT, true, false>(first, last, seed);
+        default: return updateLEDsHighPrecision<COUNT, true, true>(first, last, seed);
+    }
+}
+
+template<uint16_t COUNT, bool FADE, bool AUDIO>
+uint16_t AvantLumi::updateLEDs(uint16_t first, uint16_t last, uint16_t seed) {
+    uint32_t now = frameTime;
+    const uint16_t begin = COUNT ? 0 : first;
+    const uint16_t end = COUNT ? COUNT : last;
+    
+    for (uint16_t i = begin; i < end; i++) {
+        uint8_t fader = 255;
+        
+        if (FADE) {
+            fader = sin8(now / lumiFadeDivisor(seed));
+        }
+        if (AUDIO) {
+            fader = scale8(fader, audioScale);
+        }
+        
+        leds[i] = ColorFromPalette(currentPalette, paletteIndex(i, now) + audioIndexOffset, fader, currentBlending);
+    }
+    
+    return seed;
+}
+
+template<uint16_t COUNT, bool FADE, bool AUDIO>
+uint16_t AvantLumi::updateLEDsHighPrecision(uint16_t first, uint16_t last, uint16_t seed) {
+    // Same pattern as updateLEDs(), but palette interpolation, fade and brightness are
+    // kept in 8.8 fixed point. The fraction below 8 bits is carried to the next frame
+    // per channel, so over a few frames each LED averages out to the exact 16-bit value.
+    uint32_t now = frameTime;
+    const uint16_t begin = COUNT ? 0 : first;
+    const uint16_t end = COUNT ? COUNT : last;
+    // x + (x >> 7) maps 0..255 onto 0..256, so 0 is black and 255 is exactly unity
+    uint32_t bright = actualBrightness + (actualBrightness >> 7);
+    
+    for (uint16_t i = begin; i < end; i++) {
+        uint8_t fader = 255;
+        
+        if (FADE) {
+            fader = sin8(now / lumiFadeDivisor(seed));
+        }
+        if (AUDIO) {
+            fader = scale8(fader, audioScale);
+        }
+        
+        // LINEARBLEND lookup: blend entry hi4 toward the next one (wrapping) by lo4
+        uint8_t index = paletteIndex(i, now) + audioIndexOffset;
+        const CRGB& a = currentPalette[index >> 4];
+        const CRGB& b = currentPalette[((index >> 4) + 1) & 0x0F];
+        uint32_t f = (index & 0x0F) << 4;
+        uint32_t scale = (fader + (fader >> 7)) * bright;   // 0..65536
+        
+        for (uint8_t ch = 0; ch < 3; ch++) {
+            uint32_t color16 = a.raw[ch] * (256 - f) + b.raw[ch] * f;
+            uint32_t value = ((color16 * scale) >> 16) + ditherResidual[i].raw[ch];
+            leds[i].raw[ch] = value >> 8;
+            ditherResidual[i].raw[ch] = value & 0xFF;
+        }
+    }
+    
+    return seed;
+}
+
+template<uint16_t COUNT>
+void AvantLumi::blendLEDs(uint8_t mix) {
+    const uint16_t count = COUNT ? COUNT : numLeds;
+    for (uint16_t i = 0; i < count; i++) {
+        leds[i] = blend(keyPrev[i], keyNext[i], mix);
+    }
+}
+
+template<uint16_t COUNT>
+void AvantLumi::copyLEDs(CRGB* dst, const CRGB* src) {
+    memcpy(dst, src, (COUNT ? COUNT : numLeds) * sizeof(CRGB));
+}
+
+// Fixed-hardware variant: pin, LED count, chipset and color order are template
+// parameters. The frame buffer is part of the object (no heap), any pin and
+// chipset FastLED supports can be used, and the API is the same as AvantLumi.
+// Whole frames are rendered, blended and copied by loops instantiated for
+// NUM_LEDS, so each distinct strip type adds its own copy of them to flash
+// (one per fade, audio and precision combination).
+//
+//   AvantLumiT<5, 300> strip;                 // WS2812B, GRB
+//   AvantLumiT<16, 144, SK6812, RGB> shelf;
+template<uint8_t DATA_PIN, uint16_t NUM_LEDS,
+         template<uint8_t, EOrder> class CHIPSET = WS2812B, EOrder COLOR_ORDER = GRB>
+class AvantLumiT : public AvantLumi {
+    static_assert(NUM_LEDS > 0, "AvantLumiT needs at least one LED");
+
+private:
+    CRGB frame[NUM_LEDS];
+
+protected:
+    bool addController(CRGB* output) override {
+        controller = &FastLED.addLeds<CHIPSET, DATA_PIN, COLOR_ORDER>(output, NUM_LEDS);
+        return true;
+    }
+
+    uint16_t renderFrame(uint16_t seed) override {
+        return renderLEDs<NUM_LEDS>(0, NUM_LEDS, seed);
+    }
+    
+    void blendFrame(uint8_t mix) override {
+        blendLEDs<NUM_LEDS>(mix);
+    }
+    
+    void copyFrame(CRGB* dst, const CRGB* src) override {
+        copyLEDs<NUM_LEDS>(dst, src);
+    }
+
+public:
+    static const uint16_t ledCount = NUM_LEDS;
+
+    AvantLumiT() : AvantLumi(DATA_PIN, NUM_LEDS, frame), frame() {}
 };
 
 #endif // AVANTLUMI_H
\ No newline at end of file
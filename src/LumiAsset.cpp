@@ -0,0 +1,31 @@
+/*
+ * AvantLumi Library - Precompressed Web Assets Implementation
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ */
+
+#include "LumiAsset.h"
+
+#if defined(ESP32)
+
+void lumiCollectAssetHeaders(WebServer& server) {
+    static const char* headers[] = { "If-None-Match" };
+    server.collectHeaders(headers, 1);
+}
+
+void lumiSendAsset(WebServer& server, const LumiAsset& asset) {
+    server.sendHeader("ETag", asset.etag);
+    // Let the browser cache the page but revalidate it on every load
+    server.sendHeader("Cache-Control", "no-cache");
+    
+    if (server.header("If-None-Match") == asset.etag) {
+        server.send(304);
+        return;
+    }
+    
+    server.sendHeader("Content-Encoding", "gzip");
+    server.send_P(200, asset.contentType, (const char*)asset.data, asset.length);
+}
+
+#endif
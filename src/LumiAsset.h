@@ -0,0 +1,35 @@
+/*
+ * AvantLumi Library - Precompressed Web Assets
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * Serves gzip-compressed PROGMEM pages generated by tools/embed_asset.py.
+ * Responses carry an ETag, so a browser that already has the page gets a
+ * 304 with no body instead of the whole page.
+ */
+
+#ifndef LUMI_ASSET_H
+#define LUMI_ASSET_H
+
+#include <Arduino.h>
+
+struct LumiAsset {
+    const uint8_t* data;        // gzip-compressed content in PROGMEM
+    size_t length;
+    const char* contentType;
+    const char* etag;           // Quoted entity tag, e.g. "\"3f2a...\""
+};
+
+#if defined(ESP32)
+#include <WebServer.h>
+
+// Call once before server.begin() so If-None-Match is available to lumiSendAsset().
+// Replaces any header list previously passed to collectHeaders().
+void lumiCollectAssetHeaders(WebServer& server);
+
+// Sends the asset, or 304 Not Modified if the browser's copy is current
+void lumiSendAsset(WebServer& server, const LumiAsset& asset);
+#endif
+
+#endif // LUMI_ASSET_H
@@ -0,0 +1,329 @@
+/*
+ * AvantLumi Library - Audio Analysis Implementation
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ */
+
+#include "LumiAudio.h"
+#include "LumiMemory.h"
+#include <math.h>
+
+// First FFT bin of each band, plus the end of the last band (Nyquist).
+// At 16 kHz: 62, 125, 250, 375, 625, 1000, 1750, 3000-8000 Hz.
+static const uint8_t bandEdges[LUMI_AUDIO_BANDS + 1] = { 1, 2, 4, 6, 10, 16, 28, 48, LUMI_FFT_SIZE / 2 };
+
+#define BEAT_MIN_INTERVAL_MS 250    // At most 240 beats per minute
+#define BEAT_MAX_INTERVAL_MS 1500   // Longer gaps do not count toward the tempo
+
+// One full sine period in Q15; cosine is read a quarter period later
+static int16_t sineTable[LUMI_FFT_SIZE];
+static bool sineTableReady = false;
+
+static void buildSineTable() {
+    if (sineTableReady) {
+        return;
+    }
+    for (uint16_t i = 0; i < LUMI_FFT_SIZE; i++) {
+        sineTable[i] = (int16_t)lround(sin(2.0 * M_PI * i / LUMI_FFT_SIZE) * 32767.0);
+    }
+    sineTableReady = true;
+}
+
+// ================================
+// Sample sources
+// ================================
+#if !defined(ESP32)
+
+static uint16_t readLE16(const uint8_t* p) {
+    return (uint16_t)p[0] | ((uint16_t)p[1] << 8);
+}
+
+static uint32_t readLE32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+LumiWavSource::LumiWavSource() {
+    file = nullptr;
+    dataStart = 0;
+    dataBytes = 0;
+    position = 0;
+    rate = 0;
+    channels = 0;
+    looping = false;
+}
+
+LumiWavSource::~LumiWavSource() {
+    close();
+}
+
+bool LumiWavSource::open(const char* path, bool loop) {
+    close();
+    file = fopen(path, "rb");
+    if (file == nullptr) {
+        return false;
+    }
+
+    uint8_t header[16];
+    if (fread(header, 1, 12, file) != 12 ||
+        memcmp(header, "RIFF", 4) != 0 || memcmp(header + 8, "WAVE", 4) != 0) {
+        close();
+        return false;
+    }
+
+    bool haveFormat = false;
+    while (fread(header, 1, 8, file) == 8) {
+        uint32_t size = readLE32(header + 4);
+
+        if (memcmp(header, "fmt ", 4) == 0 && size >= 16) {
+            uint8_t fmt[16];
+            if (fread(fmt, 1, 16, file) != 16) {
+                break;
+            }
+            // PCM, 16 bits, mono or stereo only
+            if (readLE16(fmt) != 1 || readLE16(fmt + 14) != 16 ||
+                readLE16(fmt + 2) < 1 || readLE16(fmt + 2) > 2) {
+                break;
+            }
+            channels = readLE16(fmt + 2);
+            rate = readLE32(fmt + 4);
+            haveFormat = true;
+            fseek(file, (size - 16) + (size & 1), SEEK_CUR);
+        } else if (memcmp(header, "data", 4) == 0 && haveFormat) {
+            dataStart = ftell(file);
+            dataBytes = size;
+            position = 0;
+            looping = loop;
+            return true;
+        } else {
+            fseek(file, size + (size & 1), SEEK_CUR);   // Chunks are word aligned
+        }
+    }
+
+    close();
+    return false;
+}
+
+void LumiWavSource::close() {
+    if (file) {
+        fclose(file);
+        file = nullptr;
+    }
+    dataBytes = 0;
+    position = 0;
+}
+
+size_t LumiWavSource::read(int16_t* samples, size_t count) {
+    if (file == nullptr) {
+        return 0;
+    }
+
+    uint8_t raw[64 * 4];
+    size_t frameBytes = channels * 2;
+    size_t done = 0;
+    while (done < count) {
+        if (position + frameBytes > dataBytes) {
+            if (!looping || dataBytes < frameBytes) {
+                break;
+            }
+            fseek(file, dataStart, SEEK_SET);
+            position = 0;
+        }
+
+        size_t frames = min(count - done, (size_t)(dataBytes - position) / frameBytes);
+        frames = min(frames, sizeof(raw) / frameBytes);
+        size_t got = fread(raw, frameBytes, frames, file);
+        if (got == 0) {
+            break;
+        }
+        for (size_t i = 0; i < got; i++) {
+            int32_t v = (int16_t)readLE16(raw + i * frameBytes);
+            if (channels == 2) {
+                v = (v + (int16_t)readLE16(raw + i * frameBytes + 2)) / 2;
+            }
+            samples[done + i] = (int16_t)v;
+        }
+        done += got;
+        position += got * frameBytes;
+    }
+    return done;
+}
+
+uint32_t LumiWavSource::sampleRate() {
+    return rate;
+}
+
+bool LumiWavSource::isFinished() {
+    return file == nullptr || (!looping && position + channels * 2 > dataBytes);
+}
+
+#endif
+
+// ================================
+// Analyzer
+// ================================
+LumiAudio::LumiAudio() {
+    source = nullptr;
+    re = nullptr;
+    im = nullptr;
+    end();
+}
+
+LumiAudio::~LumiAudio() {
+    end();
+}
+
+bool LumiAudio::begin(LumiAudioSource& audioSource) {
+    end();
+    buildSineTable();
+
+    re = lumiCounted((int16_t*)malloc(LUMI_FFT_SIZE * sizeof(int16_t)));
+    im = lumiCounted((int16_t*)malloc(LUMI_FFT_SIZE * sizeof(int16_t)));
+    if (re == nullptr || im == nullptr) {
+        end();
+        return false;
+    }
+    source = &audioSource;
+    return true;
+}
+
+void LumiAudio::end() {
+    free(re);
+    free(im);
+    re = nullptr;
+    im = nullptr;
+    source = nullptr;
+    fill = 0;
+    for (uint8_t b = 0; b < LUMI_AUDIO_BANDS; b++) {
+        bandPeak[b] = 0;
+    }
+    levelPeak = 0;
+    bassAverage = 0;
+    lastBeatMs = 0;
+    beatInterval = 0;
+    lastBlockMs = 0;
+    blocks = 0;
+    memset(&levels, 0, sizeof(levels));
+}
+
+bool LumiAudio::poll(uint32_t nowMs) {
+    if (source == nullptr) {
+        return false;
+    }
+
+    fill += source->read(re + fill, LUMI_FFT_SIZE - fill);
+    if (fill < LUMI_FFT_SIZE) {
+        return false;
+    }
+
+    analyze(nowMs);
+    fill = 0;
+    lastBlockMs = nowMs;
+    return true;
+}
+
+void LumiAudio::analyze(uint32_t nowMs) {
+    // Hann window, then transform in place
+    for (uint16_t n = 0; n < LUMI_FFT_SIZE; n++) {
+        int32_t w = (32767 - sineTable[(n + LUMI_FFT_SIZE / 4) & (LUMI_FFT_SIZE - 1)]) >> 1;
+        re[n] = (int16_t)(((int32_t)re[n] * w) >> 15);
+        im[n] = 0;
+    }
+    fft(re, im);
+
+    // Band sums of approximate magnitudes (max + 3/8 min, within 7% of the true value)
+    uint32_t raw[LUMI_AUDIO_BANDS];
+    uint32_t total = 0;
+    for (uint8_t b = 0; b < LUMI_AUDIO_BANDS; b++) {
+        uint32_t sum = 0;
+        for (uint16_t k = bandEdges[b]; k < bandEdges[b + 1]; k++) {
+            uint32_t a = abs(re[k]);
+            uint32_t c = abs(im[k]);
+            sum += (a > c) ? a + ((c * 3) >> 3) : c + ((a * 3) >> 3);
+        }
+        raw[b] = sum < LUMI_AUDIO_NOISE_FLOOR ? 0 : sum;
+        total += raw[b];
+
+        // Gain control: follow peaks, decay toward the floor in about a second and a half
+        bandPeak[b] -= bandPeak[b] >> 7;
+        bandPeak[b] = max(max(bandPeak[b], raw[b]), (uint32_t)LUMI_AUDIO_NOISE_FLOOR * 8);
+        levels.bands[b] = (uint8_t)((raw[b] * 255) / bandPeak[b]);
+    }
+
+    levelPeak -= levelPeak >> 7;
+    levelPeak = max(max(levelPeak, total), (uint32_t)LUMI_AUDIO_NOISE_FLOOR * 8 * LUMI_AUDIO_BANDS);
+    levels.level = (uint8_t)((total * 255) / levelPeak);
+
+    // Beat: bass well above its recent average, timed in audio samples rather than wall
+    // clock so a WAV file analyzed faster than real time gives the same result
+    uint32_t rate = source->sampleRate();
+    uint32_t audioMs = rate ? (uint32_t)(((uint64_t)blocks * LUMI_FFT_SIZE * 1000) / rate) : nowMs;
+    uint32_t bass = raw[0] + raw[1];
+    levels.beat = false;
+    if (bass > bassAverage + bassAverage / 2 && bass > LUMI_AUDIO_NOISE_FLOOR * 2 &&
+        (lastBeatMs == 0 || audioMs - lastBeatMs >= BEAT_MIN_INTERVAL_MS)) {
+        uint32_t interval = audioMs - lastBeatMs;
+        if (lastBeatMs != 0 && interval <= BEAT_MAX_INTERVAL_MS) {
+            beatInterval = beatInterval ? (beatInterval * 3 + interval) / 4 : interval;
+            levels.bpm = (uint16_t)(60000UL / beatInterval);
+        }
+        lastBeatMs = audioMs ? audioMs : 1;
+        levels.beat = true;
+    }
+    bassAverage = (bassAverage * 15 + bass) / 16;
+    blocks++;
+}
+
+void LumiAudio::fft(int16_t* real, int16_t* imag) {
+    buildSineTable();
+
+    // Bit-reversal permutation
+    for (uint16_t i = 1, j = 0; i < LUMI_FFT_SIZE; i++) {
+        uint16_t bit = LUMI_FFT_SIZE >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            int16_t t = real[i]; real[i] = real[j]; real[j] = t;
+            t = imag[i]; imag[i] = imag[j]; imag[j] = t;
+        }
+    }
+
+    // Radix-2 butterflies, halving every stage so values never leave 16 bits
+    for (uint16_t size = 2; size <= LUMI_FFT_SIZE; size <<= 1) {
+        uint16_t half = size >> 1;
+        uint16_t step = LUMI_FFT_SIZE / size;
+        for (uint16_t k = 0; k < half; k++) {
+            int32_t wr = sineTable[(k * step + LUMI_FFT_SIZE / 4) & (LUMI_FFT_SIZE - 1)];
+            int32_t wi = -sineTable[k * step];
+            for (uint16_t i = k; i < LUMI_FFT_SIZE; i += size) {
+                uint16_t j = i + half;
+                int32_t tr = (wr * real[j] - wi * imag[j]) >> 15;
+                int32_t ti = (wr * imag[j] + wi * real[j]) >> 15;
+                int32_t ur = real[i];
+                int32_t ui = imag[i];
+                real[j] = (int16_t)((ur - tr) >> 1);
+                imag[j] = (int16_t)((ui - ti) >> 1);
+                real[i] = (int16_t)((ur + tr) >> 1);
+                imag[i] = (int16_t)((ui + ti) >> 1);
+            }
+        }
+    }
+}
+
+bool LumiAudio::isActive(uint32_t nowMs) {
+    return source != nullptr && blocks > 0 && nowMs - lastBlockMs <= LUMI_AUDIO_TIMEOUT_MS;
+}
+
+const LumiAudioLevels& LumiAudio::getLevels() {
+    return levels;
+}
+
+uint32_t LumiAudio::getBlockCount() {
+    return blocks;
+}
+
+size_t LumiAudio::getBufferBytes() {
+    return re != nullptr ? 2 * LUMI_FFT_SIZE * sizeof(int16_t) : 0;
+}
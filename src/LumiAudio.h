@@ -0,0 +1,108 @@
+/*
+ * AvantLumi Library - Audio Analysis
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * Integer-only audio front end for the audio-reactive mode. Blocks of
+ * LUMI_FFT_SIZE samples are Hann-windowed and run through a Q15 radix-2 FFT.
+ * The bins are grouped into LUMI_AUDIO_BANDS log-spaced bands, each with its
+ * own automatic gain control, and beats are detected from the bass energy.
+ *
+ * Samples come from a LumiAudioSource: an I2S microphone on ESP32 (see
+ * LumiI2SSource.h), or a WAV file everywhere else so the analysis can be run
+ * and timed on a PC.
+ */
+
+#ifndef LUMI_AUDIO_H
+#define LUMI_AUDIO_H
+
+#include <Arduino.h>
+
+#if !defined(ESP32)
+#include <stdio.h>
+#endif
+
+#define LUMI_FFT_SIZE 256             // Samples per analysis block (power of two)
+#define LUMI_FFT_LOG2 8
+#define LUMI_AUDIO_SAMPLE_RATE 16000  // 62.5 Hz per bin, one block every 16 ms
+#define LUMI_AUDIO_BANDS 8
+#define LUMI_AUDIO_NOISE_FLOOR 24     // Band magnitudes below this count as silence
+#define LUMI_AUDIO_TIMEOUT_MS 500     // No blocks for this long = inactive
+
+// 16-bit mono PCM supplier. read() must not block.
+class LumiAudioSource {
+public:
+    virtual ~LumiAudioSource() {}
+    virtual size_t read(int16_t* samples, size_t count) = 0;
+    virtual uint32_t sampleRate() = 0;
+};
+
+#if !defined(ESP32)
+// 16-bit PCM WAV file; stereo is mixed down to mono
+class LumiWavSource : public LumiAudioSource {
+private:
+    FILE* file;
+    long dataStart;
+    uint32_t dataBytes;
+    uint32_t position;
+    uint32_t rate;
+    uint8_t channels;
+    bool looping;
+
+public:
+    LumiWavSource();
+    ~LumiWavSource();
+
+    bool open(const char* path, bool loop = false);
+    void close();
+    size_t read(int16_t* samples, size_t count) override;
+    uint32_t sampleRate() override;
+    bool isFinished();
+};
+#endif
+
+// Result of the latest analysis block
+struct LumiAudioLevels {
+    uint8_t bands[LUMI_AUDIO_BANDS];  // 0-255 per band after gain control, bass first
+    uint8_t level;                    // Overall loudness 0-255
+    bool beat;                        // Set for the block in which a beat was detected
+    uint16_t bpm;                     // Estimated tempo, 0 until a few beats were seen
+};
+
+class LumiAudio {
+private:
+    LumiAudioSource* source;
+    int16_t* re;                // Work buffers, allocated by begin()
+    int16_t* im;
+    uint16_t fill;              // Samples collected into re[] for the next block
+    uint32_t bandPeak[LUMI_AUDIO_BANDS];
+    uint32_t levelPeak;
+    uint32_t bassAverage;
+    uint32_t lastBeatMs;
+    uint32_t beatInterval;      // Smoothed ms between beats
+    uint32_t lastBlockMs;
+    uint32_t blocks;
+    LumiAudioLevels levels;
+
+    void analyze(uint32_t nowMs);
+
+public:
+    LumiAudio();
+    ~LumiAudio();
+
+    bool begin(LumiAudioSource& audioSource);
+    void end();
+
+    // Reads pending samples; returns true when a new block was analyzed
+    bool poll(uint32_t nowMs);
+    bool isActive(uint32_t nowMs);
+    const LumiAudioLevels& getLevels();
+    uint32_t getBlockCount();
+    size_t getBufferBytes();    // Heap held for the FFT work buffers
+
+    // In-place Q15 FFT of LUMI_FFT_SIZE points, scaled by 1 / LUMI_FFT_SIZE
+    static void fft(int16_t* real, int16_t* imag);
+};
+
+#endif // LUMI_AUDIO_H
@@ -0,0 +1,178 @@
+/*
+ * AvantLumi Library - Cross-Node Clock Sync Implementation
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ */
+
+#include "LumiClockSync.h"
+
+#define SYNC_PACKET_SIZE 16
+#define SYNC_VERSION 1
+#define SYNC_REQUEST 1
+#define SYNC_REPLY 2
+
+static uint32_t defaultMillis() {
+    return millis();
+}
+
+static void writeLE32(uint8_t* p, uint32_t v) {
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+}
+
+static uint32_t readLE32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+LumiClockSync::LumiClockSync() {
+    udp = nullptr;
+    role = LUMI_SYNC_OFF;
+    port = LUMI_SYNC_PORT;
+    localClock = defaultMillis;
+    offset = 0;
+    seed = 0;
+    lastRequest = 0;
+    lastReply = 0;
+    synced = false;
+    sampleHead = 0;
+    sampleCount = 0;
+}
+
+bool LumiClockSync::begin(UDP& socket, LumiSyncRole syncRole, uint16_t syncPort) {
+    if (!socket.begin(syncPort)) {
+        return false;
+    }
+    udp = &socket;
+    role = syncRole;
+    port = syncPort;
+    synced = (syncRole == LUMI_SYNC_MASTER);
+    sampleCount = 0;
+    // Send the first request on the next poll()
+    lastRequest = localClock() - LUMI_SYNC_INTERVAL_MS;
+    return true;
+}
+
+void LumiClockSync::end() {
+    if (udp) {
+        udp->stop();
+        udp = nullptr;
+    }
+    role = LUMI_SYNC_OFF;
+    synced = false;
+}
+
+void LumiClockSync::setLocalClock(LumiMillisFn clockFn) {
+    localClock = clockFn ? clockFn : defaultMillis;
+}
+
+void LumiClockSync::poll() {
+    if (udp == nullptr) {
+        return;
+    }
+
+    uint32_t localNow = localClock();
+    uint8_t packet[SYNC_PACKET_SIZE];
+
+    int size;
+    while ((size = udp->parsePacket()) > 0) {
+        if (size == SYNC_PACKET_SIZE && udp->read(packet, SYNC_PACKET_SIZE) == SYNC_PACKET_SIZE) {
+            handlePacket(packet, localClock());
+        }
+    }
+
+    if (role == LUMI_SYNC_FOLLOWER) {
+        if (localNow - lastRequest >= LUMI_SYNC_INTERVAL_MS) {
+            sendRequest(localNow);
+        }
+        if (synced && localNow - lastReply > LUMI_SYNC_TIMEOUT_MS) {
+            synced = false; // Keep the last offset, but report that it is going stale
+        }
+    }
+}
+
+void LumiClockSync::sendRequest(uint32_t localNow) {
+    uint8_t packet[SYNC_PACKET_SIZE] = { 'L', 'S', SYNC_REQUEST, SYNC_VERSION };
+    writeLE32(packet + 4, localNow);
+
+    // Broadcast so followers need no master address; any master answers
+    udp->beginPacket(IPAddress(255, 255, 255, 255), port);
+    udp->write(packet, sizeof(packet));
+    udp->endPacket();
+    lastRequest = localNow;
+}
+
+void LumiClockSync::handlePacket(const uint8_t* packet, uint32_t localNow) {
+    if (packet[0] != 'L' || packet[1] != 'S' || packet[3] != SYNC_VERSION) {
+        return;
+    }
+
+    if (packet[2] == SYNC_REQUEST && role == LUMI_SYNC_MASTER) {
+        uint8_t reply[SYNC_PACKET_SIZE] = { 'L', 'S', SYNC_REPLY, SYNC_VERSION };
+        memcpy(reply + 4, packet + 4, 4);           // Echo t0
+        writeLE32(reply + 8, now());
+        writeLE32(reply + 12, seed);
+        udp->beginPacket(udp->remoteIP(), udp->remotePort());
+        udp->write(reply, sizeof(reply));
+        udp->endPacket();
+        return;
+    }
+
+    if (packet[2] == SYNC_REPLY && role == LUMI_SYNC_FOLLOWER) {
+        uint32_t t0 = readLE32(packet + 4);
+        uint32_t t1 = readLE32(packet + 8);
+        uint32_t rtt = localNow - t0;
+        if (rtt > LUMI_SYNC_MAX_RTT_MS) {
+            return; // Stale reply or congested network - not worth trusting
+        }
+
+        // Master time at arrival is estimated as t1 + rtt / 2
+        sampleRtt[sampleHead] = rtt;
+        sampleOffset[sampleHead] = (int32_t)(t1 + rtt / 2 - localNow);
+        sampleHead = (sampleHead + 1) % LUMI_SYNC_SAMPLES;
+        if (sampleCount < LUMI_SYNC_SAMPLES) {
+            sampleCount++;
+        }
+
+        uint8_t best = 0;
+        for (uint8_t i = 1; i < sampleCount; i++) {
+            if (sampleRtt[i] < sampleRtt[best]) {
+                best = i;
+            }
+        }
+        offset = sampleOffset[best];
+        seed = readLE32(packet + 12);
+        lastReply = localNow;
+        synced = true;
+    }
+}
+
+uint32_t LumiClockSync::now() {
+    return localClock() + offset;
+}
+
+uint32_t LumiClockSync::localNow() {
+    return localClock();
+}
+
+void LumiClockSync::setSeed(uint32_t value) {
+    seed = value;
+}
+
+uint32_t LumiClockSync::getSeed() {
+    return seed;
+}
+
+int32_t LumiClockSync::getOffset() {
+    return offset;
+}
+
+LumiSyncRole LumiClockSync::getRole() {
+    return role;
+}
+
+bool LumiClockSync::isSynced() {
+    return synced;
+}
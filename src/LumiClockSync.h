@@ -0,0 +1,82 @@
+/*
+ * AvantLumi Library - Cross-Node Clock Sync
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * Keeps a shared "show time" and random seed across controllers so every node
+ * renders the same frame for the same moment. One node is the master; followers
+ * periodically send a request and estimate their offset from the round trip
+ * (NTP style), keeping the sample with the lowest round-trip time.
+ *
+ * Packet (16 bytes, little-endian):
+ *   char     magic[2]  "LS"
+ *   uint8_t  type      1 = request, 2 = reply
+ *   uint8_t  version   1
+ *   uint32_t t0        follower local time when the request was sent
+ *   uint32_t t1        master show time when the reply was sent
+ *   uint32_t seed      shared seed for random generators
+ */
+
+#ifndef LUMI_CLOCK_SYNC_H
+#define LUMI_CLOCK_SYNC_H
+
+#include <Arduino.h>
+#include <Udp.h>
+
+#define LUMI_SYNC_PORT 4049
+#define LUMI_SYNC_INTERVAL_MS 2000    // Follower request period
+#define LUMI_SYNC_MAX_RTT_MS 200      // Samples slower than this are ignored
+#define LUMI_SYNC_TIMEOUT_MS 10000    // Follower counts as unsynced after this
+#define LUMI_SYNC_SAMPLES 8           // Window for the lowest-RTT filter
+
+enum LumiSyncRole {
+    LUMI_SYNC_OFF,
+    LUMI_SYNC_MASTER,
+    LUMI_SYNC_FOLLOWER
+};
+
+// Local millisecond clock; replaceable to simulate skewed nodes
+typedef uint32_t (*LumiMillisFn)();
+
+class LumiClockSync {
+private:
+    UDP* udp;
+    LumiSyncRole role;
+    uint16_t port;
+    LumiMillisFn localClock;
+    int32_t offset;             // show time = local time + offset
+    uint32_t seed;
+    uint32_t lastRequest;
+    uint32_t lastReply;
+    bool synced;
+
+    // Lowest-RTT filter
+    uint32_t sampleRtt[LUMI_SYNC_SAMPLES];
+    int32_t sampleOffset[LUMI_SYNC_SAMPLES];
+    uint8_t sampleHead;
+    uint8_t sampleCount;
+
+    void sendRequest(uint32_t localNow);
+    void handlePacket(const uint8_t* packet, uint32_t localNow);
+
+public:
+    LumiClockSync();
+
+    bool begin(UDP& socket, LumiSyncRole syncRole, uint16_t syncPort = LUMI_SYNC_PORT);
+    void end();
+    void setLocalClock(LumiMillisFn clockFn);
+
+    // Services the socket; call once per frame
+    void poll();
+
+    uint32_t now();             // Shared show time in ms
+    uint32_t localNow();        // Local clock, unadjusted
+    void setSeed(uint32_t value);
+    uint32_t getSeed();
+    int32_t getOffset();
+    LumiSyncRole getRole();
+    bool isSynced();
+};
+
+#endif // LUMI_CLOCK_SYNC_H
@@ -0,0 +1,190 @@
+/*
+ * AvantLumi Library - Cue Scheduler Implementation
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ */
+
+#include "LumiCueScheduler.h"
+#include "LumiMemory.h"
+
+static time_t defaultClock() {
+    return time(nullptr);
+}
+
+LumiCueScheduler::LumiCueScheduler() {
+    heap = nullptr;
+    size = 0;
+    capacity = 0;
+    nextId = 0;
+    lastNow = 0;
+    clock = defaultClock;
+}
+
+LumiCueScheduler::~LumiCueScheduler() {
+    free(heap);
+}
+
+bool LumiCueScheduler::begin(uint16_t maxCues) {
+    // Fixed capacity so adding cues never touches the heap allocator
+    LumiCue* storage = lumiCounted(static_cast<LumiCue*>(malloc((size_t)maxCues * sizeof(LumiCue))));
+    if (storage == nullptr && maxCues > 0) {
+        return false;
+    }
+    free(heap);
+    heap = storage;
+    capacity = maxCues;
+    size = 0;
+    return true;
+}
+
+void LumiCueScheduler::setClock(LumiClockFn clockFn) {
+    clock = clockFn ? clockFn : defaultClock;
+    lastNow = 0; // Force every cue to be recomputed against the new clock
+}
+
+time_t LumiCueScheduler::now() {
+    return clock();
+}
+
+int LumiCueScheduler::addCue(uint8_t hour, uint8_t minute, uint8_t second, uint8_t days,
+                             LumiCueAction action, uint8_t value) {
+    if (size >= capacity || hour > 23 || minute > 59 || second > 59 || (days & LUMI_CUE_EVERY_DAY) == 0) {
+        return -1;
+    }
+
+    LumiCue& cue = heap[size];
+    uint16_t id = nextId++;
+    cue.id = id;
+    cue.hour = hour;
+    cue.minute = minute;
+    cue.second = second;
+    cue.days = days & LUMI_CUE_EVERY_DAY;
+    cue.action = action;
+    cue.value = value;
+    // Until the clock is valid the cue waits at 0; poll() recomputes on first valid time
+    cue.nextFire = lastNow ? computeNextFire(cue, lastNow) : 0;
+
+    siftUp(size++);
+    return id;
+}
+
+bool LumiCueScheduler::removeCue(uint16_t id) {
+    for (uint16_t i = 0; i < size; i++) {
+        if (heap[i].id == id) {
+            heap[i] = heap[--size];
+            if (i < size) {
+                siftUp(i);
+                siftDown(i);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+void LumiCueScheduler::clear() {
+    size = 0;
+}
+
+uint16_t LumiCueScheduler::count() {
+    return size;
+}
+
+uint16_t LumiCueScheduler::getCapacity() {
+    return capacity;
+}
+
+time_t LumiCueScheduler::nextFireTime() {
+    return size > 0 ? heap[0].nextFire : 0;
+}
+
+bool LumiCueScheduler::poll(time_t now, LumiCue& due) {
+    if (size == 0 || now < (time_t)LUMI_CUE_MIN_VALID_TIME) {
+        return false;
+    }
+
+    // First valid time or clock stepped backwards: recompute every fire time.
+    // After a jump forward of more than an hour (NTP sync, DST change, a long
+    // idle sleep) cues that came due in the gap are kept, so they still fire.
+    if (lastNow == 0 || now < lastNow) {
+        reschedule(now, false);
+    } else if (now - lastNow > 3600) {
+        reschedule(now, true);
+    }
+    lastNow = now;
+
+    if (heap[0].nextFire > now) {
+        return false;
+    }
+
+    due = heap[0];
+    heap[0].nextFire = computeNextFire(heap[0], now);
+    siftDown(0);
+    return true;
+}
+
+time_t LumiCueScheduler::computeNextFire(const LumiCue& cue, time_t after) {
+    struct tm today;
+    localtime_r(&after, &today);
+
+    // At most a week ahead; mktime() normalizes day overflow and DST
+    for (uint8_t d = 0; d <= 7; d++) {
+        struct tm candidate = today;
+        candidate.tm_mday += d;
+        candidate.tm_hour = cue.hour;
+        candidate.tm_min = cue.minute;
+        candidate.tm_sec = cue.second;
+        candidate.tm_isdst = -1;
+        time_t when = mktime(&candidate);
+        if (when > after && (cue.days & (1 << candidate.tm_wday))) {
+            return when;
+        }
+    }
+    return after + 7L * 24 * 3600; // Not reachable with a non-empty day mask
+}
+
+void LumiCueScheduler::reschedule(time_t now, bool keepDue) {
+    for (uint16_t i = 0; i < size; i++) {
+        // A cue still waiting at 0 never had a valid fire time
+        if (!keepDue || heap[i].nextFire == 0 || heap[i].nextFire > now) {
+            heap[i].nextFire = computeNextFire(heap[i], now);
+        }
+    }
+    // Bottom-up heapify
+    for (int i = size / 2 - 1; i >= 0; i--) {
+        siftDown(i);
+    }
+}
+
+void LumiCueScheduler::siftUp(uint16_t index) {
+    LumiCue item = heap[index];
+    while (index > 0) {
+        uint16_t parent = (index - 1) / 2;
+        if (heap[parent].nextFire <= item.nextFire) {
+            break;
+        }
+        heap[index] = heap[parent];
+        index = parent;
+    }
+    heap[index] = item;
+}
+
+void LumiCueScheduler::siftDown(uint16_t index) {
+    LumiCue item = heap[index];
+    for (;;) {
+        uint16_t child = index * 2 + 1;
+        if (child >= size) {
+            break;
+        }
+        if (child + 1 < size && heap[child + 1].nextFire < heap[child].nextFire) {
+            child++;
+        }
+        if (item.nextFire <= heap[child].nextFire) {
+            break;
+        }
+        heap[index] = heap[child];
+        index = child;
+    }
+    heap[index] = item;
+}
@@ -0,0 +1,82 @@
+/*
+ * AvantLumi Library - Cue Scheduler
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * Time-of-day / day-of-week cues kept in a min-heap ordered by next fire
+ * time, so polling only ever looks at the earliest cue.
+ */
+
+#ifndef LUMI_CUE_SCHEDULER_H
+#define LUMI_CUE_SCHEDULER_H
+
+#include <Arduino.h>
+#include <time.h>
+
+// What a cue does when it fires
+enum LumiCueAction {
+    LUMI_CUE_SWITCH,    // value: 0 = off, 1 = on
+    LUMI_CUE_BRIGHT,    // value: brightness level 1-5
+    LUMI_CUE_PALETTE,   // value: LumiPaletteId
+    LUMI_CUE_PRESET     // value: preset slot
+};
+
+// Day-of-week masks (bit 0 = Sunday, as in tm_wday)
+#define LUMI_CUE_EVERY_DAY 0x7F
+#define LUMI_CUE_WEEKDAYS  0x3E
+#define LUMI_CUE_WEEKENDS  0x41
+
+// Times before this are treated as "clock not set yet" (e.g. before NTP sync)
+#define LUMI_CUE_MIN_VALID_TIME 1577836800UL  // 2020-01-01
+
+struct LumiCue {
+    time_t nextFire;
+    uint16_t id;
+    uint8_t hour;
+    uint8_t minute;
+    uint8_t second;
+    uint8_t days;       // LUMI_CUE_* day mask
+    uint8_t action;     // LumiCueAction
+    uint8_t value;
+};
+
+// Returns the current time in epoch seconds (cue times are local, via the TZ setting).
+// Replace it to drive the scheduler from simulated time.
+typedef time_t (*LumiClockFn)();
+
+class LumiCueScheduler {
+private:
+    LumiCue* heap;
+    uint16_t size;
+    uint16_t capacity;
+    uint16_t nextId;
+    time_t lastNow;
+    LumiClockFn clock;
+
+    time_t computeNextFire(const LumiCue& cue, time_t after);
+    void reschedule(time_t now, bool keepDue);
+    void siftUp(uint16_t index);
+    void siftDown(uint16_t index);
+
+public:
+    LumiCueScheduler();
+    ~LumiCueScheduler();
+
+    bool begin(uint16_t maxCues);
+    void setClock(LumiClockFn clockFn);
+    time_t now();
+
+    int addCue(uint8_t hour, uint8_t minute, uint8_t second, uint8_t days,
+               LumiCueAction action, uint8_t value);
+    bool removeCue(uint16_t id);
+    void clear();
+    uint16_t count();
+    uint16_t getCapacity();
+    time_t nextFireTime();
+
+    // Pops the earliest cue if it is due at 'now' and re-queues its next occurrence
+    bool poll(time_t now, LumiCue& due);
+};
+
+#endif // LUMI_CUE_SCHEDULER_H
@@ -0,0 +1,149 @@
+/*
+ * AvantLumi Library - I2S Microphone Source Implementation
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ */
+
+#include "LumiI2SSource.h"
+
+#if defined(ESP32)
+
+LumiI2SSource::LumiI2SSource() {
+#if defined(LUMI_I2S_STD_DRIVER)
+    channel = nullptr;
+#endif
+    port = I2S_NUM_0;
+    rate = LUMI_AUDIO_SAMPLE_RATE;
+    installed = false;
+}
+
+LumiI2SSource::~LumiI2SSource() {
+    end();
+}
+
+#if defined(LUMI_I2S_STD_DRIVER)
+
+bool LumiI2SSource::begin(int bckPin, int wsPin, int dataPin, uint32_t sampleRate, i2s_port_t i2sPort) {
+    end();
+
+    i2s_chan_config_t chanConfig = I2S_CHANNEL_DEFAULT_CONFIG(i2sPort, I2S_ROLE_MASTER);
+    chanConfig.dma_desc_num = 4;
+    chanConfig.dma_frame_num = LUMI_FFT_SIZE;   // Keeps at most four blocks of latency queued
+    if (i2s_new_channel(&chanConfig, nullptr, &channel) != ESP_OK) {
+        channel = nullptr;
+        return false;
+    }
+
+    i2s_std_config_t config = {
+        .clk_cfg = I2S_STD_CLK_DEFAULT_CONFIG(sampleRate),
+        .slot_cfg = I2S_STD_PHILIPS_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_32BIT, I2S_SLOT_MODE_MONO),
+        .gpio_cfg = {
+            .mclk = I2S_GPIO_UNUSED,
+            .bclk = (gpio_num_t)bckPin,
+            .ws = (gpio_num_t)wsPin,
+            .dout = I2S_GPIO_UNUSED,
+            .din = (gpio_num_t)dataPin,
+            .invert_flags = { false, false, false },
+        },
+    };
+    config.slot_cfg.slot_mask = I2S_STD_SLOT_LEFT;
+
+    if (i2s_channel_init_std_mode(channel, &config) != ESP_OK || i2s_channel_enable(channel) != ESP_OK) {
+        i2s_del_channel(channel);
+        channel = nullptr;
+        return false;
+    }
+    port = i2sPort;
+    rate = sampleRate;
+    installed = true;
+    return true;
+}
+
+void LumiI2SSource::end() {
+    if (installed) {
+        i2s_channel_disable(channel);
+        i2s_del_channel(channel);
+        channel = nullptr;
+        installed = false;
+    }
+}
+
+#else
+
+bool LumiI2SSource::begin(int bckPin, int wsPin, int dataPin, uint32_t sampleRate, i2s_port_t i2sPort) {
+    end();
+
+    i2s_config_t config = {};
+    config.mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_RX);
+    config.sample_rate = sampleRate;
+    config.bits_per_sample = I2S_BITS_PER_SAMPLE_32BIT;
+    config.channel_format = I2S_CHANNEL_FMT_ONLY_LEFT;
+    config.communication_format = I2S_COMM_FORMAT_STAND_I2S;
+    config.dma_buf_count = 4;
+    config.dma_buf_len = LUMI_FFT_SIZE;   // Keeps at most four blocks of latency queued
+
+    i2s_pin_config_t pins = {};
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(4, 4, 0)
+    pins.mck_io_num = I2S_PIN_NO_CHANGE;
+#endif
+    pins.bck_io_num = bckPin;
+    pins.ws_io_num = wsPin;
+    pins.data_out_num = I2S_PIN_NO_CHANGE;
+    pins.data_in_num = dataPin;
+
+    if (i2s_driver_install(i2sPort, &config, 0, nullptr) != ESP_OK) {
+        return false;
+    }
+    if (i2s_set_pin(i2sPort, &pins) != ESP_OK) {
+        i2s_driver_uninstall(i2sPort);
+        return false;
+    }
+    port = i2sPort;
+    rate = sampleRate;
+    installed = true;
+    return true;
+}
+
+void LumiI2SSource::end() {
+    if (installed) {
+        i2s_driver_uninstall(port);
+        installed = false;
+    }
+}
+
+#endif // LUMI_I2S_STD_DRIVER
+
+size_t LumiI2SSource::read(int16_t* samples, size_t count) {
+    if (!installed) {
+        return 0;
+    }
+
+    int32_t raw[64];
+    size_t done = 0;
+    while (done < count) {
+        size_t want = min(count - done, sizeof(raw) / sizeof(raw[0]));
+        size_t bytes = 0;
+#if defined(LUMI_I2S_STD_DRIVER)
+        i2s_channel_read(channel, raw, want * sizeof(int32_t), &bytes, 0);   // No wait
+#else
+        i2s_read(port, raw, want * sizeof(int32_t), &bytes, 0);   // No wait
+#endif
+        size_t got = bytes / sizeof(int32_t);
+        for (size_t i = 0; i < got; i++) {
+            // 24-bit sample, left-justified; keep a little headroom for quiet mics
+            samples[done + i] = (int16_t)constrain(raw[i] >> 14, -32768, 32767);
+        }
+        done += got;
+        if (got < want) {
+            break; // DMA buffer drained
+        }
+    }
+    return done;
+}
+
+uint32_t LumiI2SSource::sampleRate() {
+    return rate;
+}
+
+#endif // ESP32
@@ -0,0 +1,58 @@
+/*
+ * AvantLumi Library - I2S Microphone Source
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * Opt-in LumiAudioSource for I2S MEMS microphones on ESP32. AvantLumi does not
+ * include this header, so sketches without a microphone never reference the
+ * I2S driver. On ESP-IDF 5 (Arduino-ESP32 3.x) the standard-mode channel API
+ * is used, which can coexist with other users of the new I2S driver; older
+ * cores fall back to the legacy driver.
+ *
+ *   #include <LumiI2SSource.h>
+ *   LumiI2SSource mic;
+ *   mic.begin(26, 25, 33);
+ *   lumi.beginAudio(mic);
+ */
+
+#ifndef LUMI_I2S_SOURCE_H
+#define LUMI_I2S_SOURCE_H
+
+#include "LumiAudio.h"
+
+#if defined(ESP32)
+
+#include <esp_idf_version.h>
+
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+#include <driver/i2s_std.h>
+#define LUMI_I2S_STD_DRIVER
+#else
+#include <driver/i2s.h>
+#endif
+
+// I2S MEMS microphone (INMP441, SPH0645 and similar, 24 bits in 32-bit slots)
+class LumiI2SSource : public LumiAudioSource {
+private:
+#if defined(LUMI_I2S_STD_DRIVER)
+    i2s_chan_handle_t channel;
+#endif
+    i2s_port_t port;
+    uint32_t rate;
+    bool installed;
+
+public:
+    LumiI2SSource();
+    ~LumiI2SSource();
+
+    bool begin(int bckPin, int wsPin, int dataPin,
+               uint32_t sampleRate = LUMI_AUDIO_SAMPLE_RATE, i2s_port_t i2sPort = I2S_NUM_0);
+    void end();
+    size_t read(int16_t* samples, size_t count) override;
+    uint32_t sampleRate() override;
+};
+
+#endif // ESP32
+
+#endif // LUMI_I2S_SOURCE_H
@@ -0,0 +1,227 @@
+/*
+ * AvantLumi Library - JSON Command Reader Implementation
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ */
+
+#include "LumiJson.h"
+
+LumiJsonReader::LumiJsonReader(const char* json, size_t length) {
+    text = json;
+    end = json + (length > 0xFFFF ? 0xFFFF : length);
+    pos = json;
+    first = true;
+}
+
+void LumiJsonReader::skipSpace() {
+    while (pos < end && (*pos == ' ' || *pos == '\t' || *pos == '\r' || *pos == '\n')) {
+        pos++;
+    }
+}
+
+bool LumiJsonReader::begin() {
+    skipSpace();
+    if (pos >= end || *pos != '{') {
+        return false;
+    }
+    pos++;
+    first = true;
+    return true;
+}
+
+bool LumiJsonReader::readString(LumiJsonToken& token) {
+    pos++; // Opening quote
+    token.type = LUMI_JSON_STRING;
+    token.start = pos;
+    while (pos < end && *pos != '"') {
+        if (*pos == '\\') {
+            pos++;
+        }
+        pos++;
+    }
+    if (pos >= end) {
+        return false;
+    }
+    token.length = pos - token.start;
+    pos++; // Closing quote
+    return true;
+}
+
+bool LumiJsonReader::readValue(LumiJsonToken& token) {
+    if (pos >= end) {
+        return false;
+    }
+    token.start = pos;
+
+    char c = *pos;
+    if (c == '"') {
+        return readString(token);
+    }
+
+    if (c == '[' || c == '{') {
+        // Skip to the matching bracket; the caller decides what to do with it
+        token.type = (c == '[') ? LUMI_JSON_ARRAY : LUMI_JSON_OBJECT;
+        char stack[LUMI_JSON_MAX_DEPTH];
+        uint8_t depth = 0;
+        while (pos < end) {
+            c = *pos;
+            if (c == '"') {
+                LumiJsonToken inner;
+                if (!readString(inner)) {
+                    return false;
+                }
+                continue;
+            }
+            if (c == '[' || c == '{') {
+                if (depth == LUMI_JSON_MAX_DEPTH) {
+                    return false;
+                }
+                stack[depth++] = (c == '[') ? ']' : '}';
+            } else if (c == ']' || c == '}') {
+                if (depth == 0 || stack[--depth] != c) {
+                    return false;
+                }
+                if (depth == 0) {
+                    pos++;
+                    token.length = pos - token.start;
+                    return true;
+                }
+            }
+            pos++;
+        }
+        return false;
+    }
+
+    // Number or literal: runs until a delimiter
+    while (pos < end && *pos != ',' && *pos != '}' && *pos != ']' &&
+           *pos != ' ' && *pos != '\t' && *pos != '\r' && *pos != '\n') {
+        pos++;
+    }
+    token.length = pos - token.start;
+    if (token.length == 0) {
+        return false;
+    }
+    if (equals(token, "true") || equals(token, "false")) {
+        token.type = LUMI_JSON_BOOL;
+    } else if (equals(token, "null")) {
+        token.type = LUMI_JSON_NULL;
+    } else if (c == '-' || (c >= '0' && c <= '9')) {
+        token.type = LUMI_JSON_NUMBER;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+int8_t LumiJsonReader::next(LumiJsonToken& key, LumiJsonToken& value) {
+    skipSpace();
+    if (pos < end && *pos == '}') {
+        pos++;
+        return 0;
+    }
+    if (!first) {
+        if (pos >= end || *pos != ',') {
+            return -1;
+        }
+        pos++;
+        skipSpace();
+    }
+    first = false;
+
+    if (pos >= end || *pos != '"' || !readString(key)) {
+        return -1;
+    }
+    skipSpace();
+    if (pos >= end || *pos != ':') {
+        return -1;
+    }
+    pos++;
+    skipSpace();
+    return readValue(value) ? 1 : -1;
+}
+
+bool LumiJsonReader::finish() {
+    skipSpace();
+    return pos >= end;
+}
+
+uint16_t LumiJsonReader::offset() {
+    return pos - text;
+}
+
+bool LumiJsonReader::equals(const LumiJsonToken& token, const char* str) {
+    return strncmp(token.start, str, token.length) == 0 && str[token.length] == '\0';
+}
+
+bool LumiJsonReader::toInt(const LumiJsonToken& token, int32_t& out) {
+    if (token.type != LUMI_JSON_NUMBER) {
+        return false;
+    }
+    const char* p = token.start;
+    const char* stop = token.start + token.length;
+    bool negative = false;
+    if (*p == '-') {
+        negative = true;
+        p++;
+    }
+    if (p >= stop) {
+        return false;
+    }
+
+    int32_t value = 0;
+    for (; p < stop && *p >= '0' && *p <= '9'; p++) {
+        if (value > 99999999) {
+            return false; // Far outside any accepted range
+        }
+        value = value * 10 + (*p - '0');
+    }
+    // A zero fraction ("3.0") is still an integer
+    if (p < stop && *p == '.') {
+        for (p++; p < stop && *p == '0'; p++) {
+        }
+    }
+    if (p != stop) {
+        return false;
+    }
+    out = negative ? -value : value;
+    return true;
+}
+
+bool LumiJsonReader::toBool(const LumiJsonToken& token, bool& out) {
+    if (token.type != LUMI_JSON_BOOL) {
+        return false;
+    }
+    out = (token.start[0] == 't');
+    return true;
+}
+
+int8_t LumiJsonReader::toInts(const LumiJsonToken& token, int32_t* out, uint8_t maxCount) {
+    if (token.type != LUMI_JSON_ARRAY) {
+        return -1;
+    }
+
+    // Re-read the span between the brackets as a comma-separated list
+    LumiJsonReader items(token.start + 1, token.length - 2);
+    int8_t count = 0;
+    items.skipSpace();
+    while (items.pos < items.end) {
+        LumiJsonToken item;
+        if (count == maxCount || !items.readValue(item) || !toInt(item, out[count])) {
+            return -1;
+        }
+        count++;
+        items.skipSpace();
+        if (items.pos < items.end) {
+            if (*items.pos != ',') {
+                return -1;
+            }
+            items.pos++;
+            items.skipSpace();
+            if (items.pos >= items.end) {
+                return -1; // Trailing comma
+            }
+        }
+    }
+    return count;
+}
@@ -0,0 +1,65 @@
+/*
+ * AvantLumi Library - JSON Command Reader
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * Minimal pull reader for flat JSON objects such as
+ * {"bright":3,"palette":"ocean","rgb":[255,0,0]}. Tokens point into the
+ * caller's buffer; nothing is copied and nothing is allocated. Strings are
+ * returned without their quotes and escape sequences are not decoded.
+ */
+
+#ifndef LUMI_JSON_H
+#define LUMI_JSON_H
+
+#include <Arduino.h>
+
+#define LUMI_JSON_MAX_DEPTH 4     // Deepest nesting skipped inside a value
+
+enum LumiJsonType {
+    LUMI_JSON_NONE,
+    LUMI_JSON_STRING,
+    LUMI_JSON_NUMBER,
+    LUMI_JSON_BOOL,
+    LUMI_JSON_NULL,
+    LUMI_JSON_ARRAY,
+    LUMI_JSON_OBJECT
+};
+
+struct LumiJsonToken {
+    LumiJsonType type;
+    const char* start;      // First character (after the opening quote for strings)
+    uint16_t length;
+};
+
+class LumiJsonReader {
+private:
+    const char* text;
+    const char* end;
+    const char* pos;
+    bool first;
+
+    void skipSpace();
+    bool readString(LumiJsonToken& token);
+    bool readValue(LumiJsonToken& token);
+
+public:
+    LumiJsonReader(const char* json, size_t length);
+
+    // Consumes the opening '{'
+    bool begin();
+    // 1 = member read, 0 = end of object, -1 = syntax error at offset()
+    int8_t next(LumiJsonToken& key, LumiJsonToken& value);
+    // After the closing '}': true if only whitespace is left
+    bool finish();
+    uint16_t offset();
+
+    static bool equals(const LumiJsonToken& token, const char* str);
+    static bool toInt(const LumiJsonToken& token, int32_t& out);
+    static bool toBool(const LumiJsonToken& token, bool& out);
+    // Reads a numeric array; returns the element count, -1 if not numeric or too long
+    static int8_t toInts(const LumiJsonToken& token, int32_t* out, uint8_t maxCount);
+};
+
+#endif // LUMI_JSON_H
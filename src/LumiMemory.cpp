@@ -0,0 +1,26 @@
+/*
+ * AvantLumi Library - Heap Accounting
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ */
+
+#include "LumiMemory.h"
+
+#ifdef LUMI_HOST_MALLINFO
+#include <malloc.h>
+#endif
+
+uint32_t lumiAllocations = 0;
+
+#ifdef LUMI_HOST_MALLINFO
+uint32_t lumiMinFreeHeap = UINT32_MAX;
+
+uint32_t lumiSampleFreeHeap() {
+    uint32_t freeHeap = (uint32_t)mallinfo2().fordblks;
+    if (freeHeap < lumiMinFreeHeap) {
+        lumiMinFreeHeap = freeHeap;
+    }
+    return freeHeap;
+}
+#endif
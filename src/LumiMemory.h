@@ -0,0 +1,46 @@
+/*
+ * AvantLumi Library - Heap Accounting
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * Every heap block the library owns (frame buffers, tables, subsystems and
+ * their work buffers) is counted here, so getMemoryStats() can report how
+ * often the library went to the allocator. File handles opened by timelines
+ * and WAV sources belong to the file system and are not counted.
+ */
+
+#ifndef LUMI_MEMORY_H
+#define LUMI_MEMORY_H
+
+#include <Arduino.h>
+#include <new>
+
+#if !defined(ARDUINO) && defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+#define LUMI_HOST_MALLINFO    // Host builds report the glibc heap in getMemoryStats()
+#endif
+
+// Successful heap allocations made by the library since boot
+extern uint32_t lumiAllocations;
+
+#ifdef LUMI_HOST_MALLINFO
+// Lowest free glibc heap seen, sampled after every library allocation and
+// every getMemoryStats(). One figure for the whole process, like the ESP32's.
+extern uint32_t lumiMinFreeHeap;
+// Free heap now; lowers lumiMinFreeHeap when it is a new low
+uint32_t lumiSampleFreeHeap();
+#endif
+
+// Wrap each allocation: lumiCounted(malloc(n)), lumiCounted(new (std::nothrow) T())
+template<class T>
+inline T* lumiCounted(T* block) {
+    if (block != nullptr) {
+        lumiAllocations++;
+#ifdef LUMI_HOST_MALLINFO
+        lumiSampleFreeHeap();
+#endif
+    }
+    return block;
+}
+
+#endif // LUMI_MEMORY_H
@@ -0,0 +1,232 @@
+/*
+ * AvantLumi Library - UDP Pixel Stream Receiver Implementation
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ */
+
+#include "LumiPixelReceiver.h"
+
+// DDP header (10 bytes, 14 with timecode)
+#define DDP_HEADER_SIZE   10
+#define DDP_FLAG_VER_MASK 0xC0
+#define DDP_FLAG_VER1     0x40
+#define DDP_FLAG_TIMECODE 0x10
+#define DDP_FLAG_QUERY    0x02
+#define DDP_FLAG_PUSH     0x01
+#define DDP_ID_DISPLAY    1
+
+// E1.31 data packet: DMX data starts after a 126-byte header
+#define E131_HEADER_SIZE       126
+#define E131_OFFSET_SEQUENCE   111
+#define E131_OFFSET_OPTIONS    112
+#define E131_OFFSET_UNIVERSE   113
+#define E131_OFFSET_COUNT      123
+#define E131_OFFSET_START_CODE 125
+#define E131_OPTION_TERMINATED 0x40
+
+static const uint8_t E131_ACN_ID[12] = { 'A', 'S', 'C', '-', 'E', '1', '.', '1', '7', 0, 0, 0 };
+
+LumiPixelReceiver::LumiPixelReceiver() {
+    udp = nullptr;
+    protocol = LUMI_STREAM_DDP;
+    startUniverse = 1;
+    lastSequence = 0;
+    universeSeen = 0;
+    lastPacketMs = 0;
+    active = false;
+    resetStats();
+}
+
+bool LumiPixelReceiver::begin(UDP& socket, LumiStreamProtocol proto, uint16_t port, uint16_t firstUniverse) {
+    if (port == 0) {
+        port = (proto == LUMI_STREAM_E131) ? LUMI_E131_PORT : LUMI_DDP_PORT;
+    }
+    if (!socket.begin(port)) {
+        return false;
+    }
+    udp = &socket;
+    protocol = proto;
+    startUniverse = firstUniverse;
+    lastSequence = 0;
+    universeSeen = 0;
+    active = false;
+    return true;
+}
+
+void LumiPixelReceiver::end() {
+    if (udp) {
+        udp->stop();
+        udp = nullptr;
+    }
+    active = false;
+}
+
+uint8_t LumiPixelReceiver::poll(uint8_t* frame, size_t frameBytes, unsigned long nowMs) {
+    if (udp == nullptr || frame == nullptr) {
+        return 0;
+    }
+
+    uint8_t result = 0;
+    for (uint8_t i = 0; i < LUMI_STREAM_MAX_PACKETS; i++) {
+        int packetSize = udp->parsePacket();
+        if (packetSize <= 0) {
+            break;
+        }
+
+        uint8_t handled = (protocol == LUMI_STREAM_E131)
+                        ? handleE131(packetSize, frame, frameBytes)
+                        : handleDdp(packetSize, frame, frameBytes);
+        if (handled) {
+            result |= handled;
+            lastPacketMs = nowMs;
+            active = true;
+        }
+        if (handled & LUMI_STREAM_FRAME) {
+            break; // Let the caller show this frame before reading the next one
+        }
+    }
+    return result;
+}
+
+uint8_t LumiPixelReceiver::handleDdp(int packetSize, uint8_t* frame, size_t frameBytes) {
+    uint8_t header[DDP_HEADER_SIZE + 4];
+    if (packetSize < DDP_HEADER_SIZE || udp->read(header, DDP_HEADER_SIZE) != DDP_HEADER_SIZE) {
+        stats.dropped++;
+        return 0;
+    }
+
+    uint8_t flags = header[0];
+    if ((flags & DDP_FLAG_VER_MASK) != DDP_FLAG_VER1 || (flags & DDP_FLAG_QUERY) ||
+        (header[3] != 0 && header[3] != DDP_ID_DISPLAY)) {
+        stats.dropped++;
+        return 0; // Unsupported version, query or non-display destination
+    }
+
+    size_t headerSize = DDP_HEADER_SIZE;
+    if (flags & DDP_FLAG_TIMECODE) {
+        headerSize += 4;
+        if (udp->read(header + DDP_HEADER_SIZE, 4) != 4) {
+            stats.dropped++;
+            return 0;
+        }
+    }
+
+    // Sequence numbers run 1-15; 0 means the sender does not use them
+    uint8_t sequence = header[1] & 0x0F;
+    if (sequence != 0 && lastSequence != 0 && sequence != (lastSequence % 15) + 1) {
+        stats.outOfOrder++;
+    }
+    lastSequence = sequence;
+
+    uint32_t offset = ((uint32_t)header[4] << 24) | ((uint32_t)header[5] << 16) |
+                      ((uint32_t)header[6] << 8) | header[7];
+    uint16_t length = ((uint16_t)header[8] << 8) | header[9];
+    if ((size_t)packetSize < headerSize + length) {
+        length = packetSize - headerSize;
+    }
+
+    uint8_t result = 0;
+    if (offset < frameBytes && length > 0) {
+        size_t count = min((size_t)length, frameBytes - offset);
+        // Straight from the socket into the frame buffer - no staging copy
+        int read = udp->read(frame + offset, count);
+        if (read > 0) {
+            stats.bytes += read;
+            result |= LUMI_STREAM_DATA;
+        }
+    }
+
+    stats.packets++;
+    if (flags & DDP_FLAG_PUSH) {
+        stats.frames++;
+        result |= LUMI_STREAM_FRAME;
+    }
+    return result;
+}
+
+uint8_t LumiPixelReceiver::handleE131(int packetSize, uint8_t* frame, size_t frameBytes) {
+    uint8_t header[E131_HEADER_SIZE];
+    if (packetSize < E131_HEADER_SIZE || udp->read(header, E131_HEADER_SIZE) != E131_HEADER_SIZE ||
+        memcmp(header + 4, E131_ACN_ID, sizeof(E131_ACN_ID)) != 0 ||
+        header[E131_OFFSET_START_CODE] != 0) {
+        stats.dropped++;
+        return 0; // Not an E1.31 DMX data packet
+    }
+
+    if (header[E131_OFFSET_OPTIONS] & E131_OPTION_TERMINATED) {
+        lastPacketMs = 0;
+        active = false;
+        return 0;
+    }
+
+    uint16_t universe = ((uint16_t)header[E131_OFFSET_UNIVERSE] << 8) | header[E131_OFFSET_UNIVERSE + 1];
+    uint16_t channels = (((uint16_t)header[E131_OFFSET_COUNT] << 8) | header[E131_OFFSET_COUNT + 1]) - 1;
+    if (universe < startUniverse || channels > 512) {
+        stats.dropped++;
+        return 0;
+    }
+
+    // Each universe has its own sequence. Discard packets up to 20 behind the
+    // last one of the same universe, as E1.31 requires.
+    if (!active) {
+        universeSeen = 0; // A new stream starts fresh sequences
+    }
+    uint16_t index = universe - startUniverse;
+    if (index < LUMI_E131_MAX_UNIVERSES) {
+        uint8_t sequence = header[E131_OFFSET_SEQUENCE];
+        uint16_t bit = (uint16_t)1 << index;
+        if (universeSeen & bit) {
+            int8_t diff = (int8_t)(sequence - universeSequence[index]);
+            if (diff <= 0 && diff > -20) {
+                stats.dropped++;
+                return 0;
+            }
+            if (diff != 1) {
+                stats.outOfOrder++;
+            }
+        }
+        universeSequence[index] = sequence;
+        universeSeen |= bit;
+    }
+
+    const size_t universeBytes = LUMI_E131_PIXELS_PER_UNIVERSE * 3;
+    size_t offset = (size_t)index * universeBytes;
+    if (offset >= frameBytes) {
+        stats.dropped++;
+        return 0;
+    }
+
+    size_t count = min(min((size_t)channels, universeBytes), frameBytes - offset);
+    count = min(count, (size_t)(packetSize - E131_HEADER_SIZE));
+    int read = udp->read(frame + offset, count);
+
+    stats.packets++;
+    uint8_t result = 0;
+    if (read > 0) {
+        stats.bytes += read;
+        result |= LUMI_STREAM_DATA;
+    }
+
+    // The universe holding the end of the strip completes the frame
+    if (offset + universeBytes >= frameBytes) {
+        stats.frames++;
+        result |= LUMI_STREAM_FRAME;
+    }
+    return result;
+}
+
+bool LumiPixelReceiver::isActive(unsigned long nowMs) {
+    if (active && nowMs - lastPacketMs > LUMI_STREAM_TIMEOUT_MS) {
+        active = false;
+    }
+    return active;
+}
+
+LumiStreamStats LumiPixelReceiver::getStats() {
+    return stats;
+}
+
+void LumiPixelReceiver::resetStats() {
+    memset(&stats, 0, sizeof(stats));
+}
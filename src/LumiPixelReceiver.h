@@ -0,0 +1,71 @@
+/*
+ * AvantLumi Library - UDP Pixel Stream Receiver
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * Receives raw RGB frames over UDP and writes the payload straight into the
+ * LED frame buffer. Supports DDP (offset addressed) and E1.31/sACN (one
+ * universe of up to 170 pixels per packet, consecutive universes span the strip).
+ */
+
+#ifndef LUMI_PIXEL_RECEIVER_H
+#define LUMI_PIXEL_RECEIVER_H
+
+#include <Arduino.h>
+#include <Udp.h>
+
+#define LUMI_DDP_PORT 4048
+#define LUMI_E131_PORT 5568
+#define LUMI_E131_PIXELS_PER_UNIVERSE 170
+#define LUMI_E131_MAX_UNIVERSES 16      // Universes with their own sequence check (2720 pixels)
+#define LUMI_STREAM_TIMEOUT_MS 2500     // Fall back to internal effects after this much silence
+#define LUMI_STREAM_MAX_PACKETS 16      // Packets drained per poll, keeps update() bounded
+
+enum LumiStreamProtocol {
+    LUMI_STREAM_DDP,
+    LUMI_STREAM_E131
+};
+
+// Bits returned by LumiPixelReceiver::poll()
+#define LUMI_STREAM_DATA  0x01   // Pixel data was written
+#define LUMI_STREAM_FRAME 0x02   // A complete frame is ready to show
+
+struct LumiStreamStats {
+    uint32_t packets;       // Packets accepted
+    uint32_t frames;        // Completed frames
+    uint32_t dropped;       // Malformed, stale or out-of-range packets
+    uint32_t outOfOrder;    // Sequence gaps seen
+    uint32_t bytes;         // Pixel bytes written
+};
+
+class LumiPixelReceiver {
+private:
+    UDP* udp;
+    LumiStreamProtocol protocol;
+    uint16_t startUniverse;
+    uint8_t lastSequence;       // DDP
+    uint8_t universeSequence[LUMI_E131_MAX_UNIVERSES];  // Last E1.31 sequence, by universe - startUniverse
+    uint16_t universeSeen;      // Bit per universe with a valid universeSequence
+    unsigned long lastPacketMs;
+    bool active;
+    LumiStreamStats stats;
+
+    uint8_t handleDdp(int packetSize, uint8_t* frame, size_t frameBytes);
+    uint8_t handleE131(int packetSize, uint8_t* frame, size_t frameBytes);
+
+public:
+    LumiPixelReceiver();
+
+    bool begin(UDP& socket, LumiStreamProtocol proto, uint16_t port = 0, uint16_t firstUniverse = 1);
+    void end();
+
+    // Drains pending packets into frame (numLeds * 3 bytes of RGB); returns LUMI_STREAM_* bits
+    uint8_t poll(uint8_t* frame, size_t frameBytes, unsigned long nowMs);
+
+    bool isActive(unsigned long nowMs);
+    LumiStreamStats getStats();
+    void resetStats();
+};
+
+#endif // LUMI_PIXEL_RECEIVER_H
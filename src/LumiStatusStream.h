@@ -0,0 +1,133 @@
+/*
+ * AvantLumi Library - Status Push Stream
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * Server-Sent Events fan-out for status JSON. Opt-in: AvantLumi itself has no
+ * network dependency, so include this header next to the library that
+ * provides the client type and poll the stream from loop():
+ *
+ *   #include <WiFi.h>
+ *   #include <LumiStatusStream.h>
+ *   LumiStatusStream<WiFiClient> dashboards;
+ *   ...
+ *   lumi.update();
+ *   dashboards.update(lumi);
+ *
+ * Each change is serialized once by AvantLumi and the same text is written to
+ * every connected dashboard.
+ */
+
+#ifndef LUMI_STATUS_STREAM_H
+#define LUMI_STATUS_STREAM_H
+
+#include "AvantLumi.h"
+
+#define LUMI_STATUS_MAX_CLIENTS 4
+#define LUMI_STATUS_KEEPALIVE_MS 15000   // Comment line that also detects dead clients
+
+// ClientT is any Arduino Client: WiFiClient, EthernetClient, ...
+template<class ClientT>
+class LumiStatusStream {
+private:
+    ClientT clients[LUMI_STATUS_MAX_CLIENTS];
+    bool inUse[LUMI_STATUS_MAX_CLIENTS];
+    unsigned long lastWrite;
+    uint32_t pushedVersion;
+
+    void writeAll(const char* text, size_t length) {
+        for (uint8_t i = 0; i < LUMI_STATUS_MAX_CLIENTS; i++) {
+            if (!inUse[i]) {
+                continue;
+            }
+            if (!clients[i].connected() || clients[i].write((const uint8_t*)text, length) != length) {
+                clients[i].stop();
+                inUse[i] = false;
+            }
+        }
+        lastWrite = millis();
+    }
+
+public:
+    LumiStatusStream() {
+        for (uint8_t i = 0; i < LUMI_STATUS_MAX_CLIENTS; i++) {
+            inUse[i] = false;
+        }
+        lastWrite = 0;
+        pushedVersion = 0;
+    }
+
+    // Takes over an HTTP connection: sends SSE headers and the current status.
+    // On ESP32 call client.setNoDelay(true) first so small events go out at once.
+    bool addClient(ClientT& client, AvantLumi& lumi) {
+        static const char headers[] =
+            "HTTP/1.1 200 OK\r\n"
+            "Content-Type: text/event-stream\r\n"
+            "Cache-Control: no-cache\r\n"
+            "Connection: keep-alive\r\n"
+            "Access-Control-Allow-Origin: *\r\n"
+            "\r\n";
+        for (uint8_t i = 0; i < LUMI_STATUS_MAX_CLIENTS; i++) {
+            if (inUse[i] && !clients[i].connected()) {
+                clients[i].stop();
+                inUse[i] = false;
+            }
+        }
+        // Bring everyone up to date first, so the new client joins at the same version
+        update(lumi);
+        for (uint8_t i = 0; i < LUMI_STATUS_MAX_CLIENTS; i++) {
+            if (!inUse[i]) {
+                // Copy shares the socket, so it stays open after the HTTP handler returns
+                clients[i] = client;
+                inUse[i] = true;
+                const char* status = lumi.getStatusJson();
+                clients[i].write((const uint8_t*)headers, sizeof(headers) - 1);
+                clients[i].write((const uint8_t*)"data: ", 6);
+                clients[i].write((const uint8_t*)status, strlen(status));
+                clients[i].write((const uint8_t*)"\n\n", 2);
+                pushedVersion = lumi.getStatusVersion();
+                return true;
+            }
+        }
+        return false; // All slots busy
+    }
+
+    uint8_t clientCount() {
+        uint8_t count = 0;
+        for (uint8_t i = 0; i < LUMI_STATUS_MAX_CLIENTS; i++) {
+            if (inUse[i]) {
+                count++;
+            }
+        }
+        return count;
+    }
+
+    // Call after lumi.update(): pushes the status when it changed, otherwise
+    // sends a keep-alive now and then. Does nothing without clients.
+    void update(AvantLumi& lumi) {
+        if (clientCount() == 0) {
+            return;
+        }
+        if (pushedVersion != lumi.getStatusVersion()) {
+            const char* status = lumi.getStatusJson();
+            pushedVersion = lumi.getStatusVersion();
+            writeAll("data: ", 6);
+            writeAll(status, strlen(status));
+            writeAll("\n\n", 2);
+        } else if (millis() - lastWrite >= LUMI_STATUS_KEEPALIVE_MS) {
+            writeAll(":\n\n", 3);
+        }
+    }
+
+    void closeAll() {
+        for (uint8_t i = 0; i < LUMI_STATUS_MAX_CLIENTS; i++) {
+            if (inUse[i]) {
+                clients[i].stop();
+                inUse[i] = false;
+            }
+        }
+    }
+};
+
+#endif // LUMI_STATUS_STREAM_H
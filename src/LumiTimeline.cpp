@@ -0,0 +1,230 @@
+/*
+ * AvantLumi Library - Show Timeline Implementation
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ */
+
+#include "LumiTimeline.h"
+
+#ifdef LUMI_TIMELINE_LITTLEFS
+#include <LittleFS.h>
+#endif
+
+static uint32_t readLE32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+LumiTimeline::LumiTimeline() {
+#ifndef LUMI_TIMELINE_LITTLEFS
+    file = nullptr;
+#endif
+    opened = false;
+    playing = false;
+    looping = false;
+    count = 0;
+    duration = 0;
+    cursor = 0;
+    startMs = 0;
+    chunkStart = 0;
+    chunkCount = 0;
+}
+
+LumiTimeline::~LumiTimeline() {
+    close();
+}
+
+bool LumiTimeline::open(const char* path) {
+    close();
+
+#ifdef LUMI_TIMELINE_LITTLEFS
+    file = LittleFS.open(path, "r");
+    if (!file) {
+        return false;
+    }
+#else
+    file = fopen(path, "rb");
+    if (file == nullptr) {
+        return false;
+    }
+#endif
+    opened = true;
+
+    uint8_t header[LUMI_TIMELINE_HEADER_SIZE];
+    if (!readBytes(0, header, sizeof(header)) ||
+        memcmp(header, "LUMT", 4) != 0 ||
+        header[4] != LUMI_TIMELINE_VERSION) {
+        close();
+        return false;
+    }
+
+    looping = header[5] & 0x01;
+    count = readLE32(header + 8);
+    duration = readLE32(header + 12);
+
+    if (duration == 0 && count > 0) {
+        LumiKeyframe last;
+        if (!fetch(count - 1, last)) {
+            close();
+            return false;
+        }
+        duration = last.time;
+    }
+
+    cursor = 0;
+    chunkCount = 0;
+    return true;
+}
+
+void LumiTimeline::close() {
+    if (opened) {
+#ifdef LUMI_TIMELINE_LITTLEFS
+        file.close();
+#else
+        fclose(file);
+        file = nullptr;
+#endif
+    }
+    opened = false;
+    playing = false;
+    count = 0;
+    chunkCount = 0;
+}
+
+bool LumiTimeline::isOpen() {
+    return opened;
+}
+
+void LumiTimeline::play(unsigned long nowMs) {
+    if (!opened) {
+        return;
+    }
+    // Resume from the current cursor position
+    LumiKeyframe kf;
+    uint32_t position = (cursor > 0 && fetch(cursor - 1, kf)) ? kf.time : 0;
+    startMs = nowMs - position;
+    playing = true;
+}
+
+void LumiTimeline::stop() {
+    playing = false;
+}
+
+bool LumiTimeline::isPlaying() {
+    return playing;
+}
+
+void LumiTimeline::setLoop(bool loop) {
+    looping = loop;
+}
+
+bool LumiTimeline::getLoop() {
+    return looping;
+}
+
+bool LumiTimeline::seek(uint32_t positionMs, unsigned long nowMs, uint32_t& index) {
+    if (!opened) {
+        return false;
+    }
+    if (looping && duration > 0) {
+        positionMs %= duration;
+    }
+
+    // Binary search for the first keyframe after positionMs; touches O(log n) chunks
+    uint32_t lo = 0, hi = count;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        LumiKeyframe kf;
+        if (!fetch(mid, kf)) {
+            return false;
+        }
+        if (kf.time <= positionMs) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    cursor = lo;
+    index = lo;
+    startMs = nowMs - positionMs;
+    return true;
+}
+
+bool LumiTimeline::keyframeAt(uint32_t index, LumiKeyframe& kf) {
+    return fetch(index, kf);
+}
+
+uint32_t LumiTimeline::getDuration() {
+    return duration;
+}
+
+uint32_t LumiTimeline::getKeyframeCount() {
+    return count;
+}
+
+uint32_t LumiTimeline::getPosition(unsigned long nowMs) {
+    return playing ? (uint32_t)(nowMs - startMs) : 0;
+}
+
+bool LumiTimeline::next(unsigned long nowMs, LumiKeyframe& kf) {
+    if (!playing) {
+        return false;
+    }
+
+    if (cursor >= count) {
+        if (!looping || duration == 0) {
+            playing = false;
+            return false;
+        }
+        if (nowMs - startMs < duration) {
+            return false; // Hold the last frame until the loop point
+        }
+        startMs += duration;
+        cursor = 0;
+    }
+
+    if (!fetch(cursor, kf) || kf.time > nowMs - startMs) {
+        return false;
+    }
+    cursor++;
+    return true;
+}
+
+bool LumiTimeline::readBytes(uint32_t offset, uint8_t* buffer, size_t length) {
+#ifdef LUMI_TIMELINE_LITTLEFS
+    return file.seek(offset) && file.read(buffer, length) == length;
+#else
+    return fseek(file, offset, SEEK_SET) == 0 && fread(buffer, 1, length, file) == length;
+#endif
+}
+
+bool LumiTimeline::fetch(uint32_t index, LumiKeyframe& kf) {
+    if (index >= count) {
+        return false;
+    }
+
+    if (index < chunkStart || index >= chunkStart + chunkCount) {
+        // Load the chunk containing index in a single read
+        uint8_t raw[LUMI_TIMELINE_CHUNK * LUMI_KEYFRAME_SIZE];
+        uint32_t first = index - (index % LUMI_TIMELINE_CHUNK);
+        uint32_t n = min((uint32_t)LUMI_TIMELINE_CHUNK, count - first);
+        if (!readBytes(LUMI_TIMELINE_HEADER_SIZE + first * LUMI_KEYFRAME_SIZE, raw, n * LUMI_KEYFRAME_SIZE)) {
+            chunkCount = 0;
+            return false;
+        }
+        for (uint32_t i = 0; i < n; i++) {
+            const uint8_t* p = raw + i * LUMI_KEYFRAME_SIZE;
+            chunk[i].time = readLE32(p);
+            chunk[i].type = p[4];
+            chunk[i].a = p[5];
+            chunk[i].b = p[6];
+            chunk[i].c = p[7];
+        }
+        chunkStart = first;
+        chunkCount = n;
+    }
+
+    kf = chunk[index - chunkStart];
+    return true;
+}
@@ -0,0 +1,111 @@
+/*
+ * AvantLumi Library - Show Timeline
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * Plays a pre-authored binary show file. Keyframes are streamed from the file
+ * in small fixed-size chunks, so a show of any length uses the same RAM.
+ *
+ * File format (little-endian):
+ *   Header, 16 bytes:
+ *     char     magic[4]    "LUMT"
+ *     uint8_t  version     1
+ *     uint8_t  flags       bit 0 = loop by default
+ *     uint16_t reserved
+ *     uint32_t count       number of keyframes
+ *     uint32_t duration    loop length in ms (0 = time of the last keyframe)
+ *   Keyframe, 8 bytes each, sorted by time:
+ *     uint32_t time        ms from the start of the show
+ *     uint8_t  type        LumiKeyframeType
+ *     uint8_t  a, b, c     arguments (see LumiKeyframeType)
+ */
+
+#ifndef LUMI_TIMELINE_H
+#define LUMI_TIMELINE_H
+
+#include <Arduino.h>
+
+#if defined(ESP32) || defined(ESP8266)
+#include <FS.h>
+#define LUMI_TIMELINE_LITTLEFS
+#else
+#include <stdio.h>
+#endif
+
+#define LUMI_TIMELINE_VERSION 1
+#define LUMI_TIMELINE_HEADER_SIZE 16
+#define LUMI_KEYFRAME_SIZE 8
+#define LUMI_TIMELINE_CHUNK 16     // Keyframes held in RAM at once
+
+enum LumiKeyframeType {
+    LUMI_KF_SWITCH,     // a: 0 = off, 1 = on
+    LUMI_KF_BRIGHT,     // a: level 1-5
+    LUMI_KF_FADE,       // a: 0 = off, 1 = on
+    LUMI_KF_BLEND,      // a: blend speed 1-5
+    LUMI_KF_PALETTE,    // a: LumiPaletteId
+    LUMI_KF_RGB,        // a, b, c: red, green, blue
+    LUMI_KF_COLOR,      // a: named color id
+    LUMI_KF_PRESET,     // a: preset slot
+    LUMI_KF_CROSSFADE   // a | b << 8: crossfade duration in ms
+};
+
+struct LumiKeyframe {
+    uint32_t time;
+    uint8_t type;
+    uint8_t a;
+    uint8_t b;
+    uint8_t c;
+};
+
+class LumiTimeline {
+private:
+#ifdef LUMI_TIMELINE_LITTLEFS
+    fs::File file;
+#else
+    FILE* file;
+#endif
+    bool opened;
+    bool playing;
+    bool looping;
+    uint32_t count;
+    uint32_t duration;
+    uint32_t cursor;            // Index of the next keyframe to fire
+    unsigned long startMs;      // millis() at show position 0
+
+    // Chunk cache
+    LumiKeyframe chunk[LUMI_TIMELINE_CHUNK];
+    uint32_t chunkStart;
+    uint8_t chunkCount;
+
+    bool readBytes(uint32_t offset, uint8_t* buffer, size_t length);
+    bool fetch(uint32_t index, LumiKeyframe& kf);
+
+public:
+    LumiTimeline();
+    ~LumiTimeline();
+
+    bool open(const char* path);
+    void close();
+    bool isOpen();
+
+    void play(unsigned long nowMs);
+    void stop();
+    bool isPlaying();
+    void setLoop(bool loop);
+    bool getLoop();
+
+    // Moves playback to positionMs; index receives the first keyframe still to fire
+    bool seek(uint32_t positionMs, unsigned long nowMs, uint32_t& index);
+    // Keyframe by index, for replaying state up to a seek point
+    bool keyframeAt(uint32_t index, LumiKeyframe& kf);
+
+    uint32_t getDuration();
+    uint32_t getKeyframeCount();
+    uint32_t getPosition(unsigned long nowMs);
+
+    // Returns the next keyframe due at nowMs, if any
+    bool next(unsigned long nowMs, LumiKeyframe& kf);
+};
+
+#endif // LUMI_TIMELINE_H
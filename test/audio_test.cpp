@@ -0,0 +1,237 @@
+/*
+ * AvantLumi Library - Audio Analysis Test
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * Synthetic WAV files are written to a temporary directory and analyzed
+ * through LumiWavSource: a tone centered in one band must light only that
+ * band, and a 120 BPM kick drum must be detected beat by beat with the right
+ * tempo. Finally a controller in audio mode renders the kick as brightness
+ * flashes and returns to normal rendering after endAudio().
+ */
+
+#include <AvantLumi.h>
+#include <LumiAudio.h>
+#include <LumiHost.h>
+#include <math.h>
+#include <vector>
+#include "lumi_test.h"
+
+#define TEST_RATE 16000
+#define TEST_LEDS 60
+#define KICK_BPM 120
+
+static void put16(std::vector<uint8_t>& out, uint16_t v) {
+    out.push_back(v & 0xFF);
+    out.push_back(v >> 8);
+}
+
+static void put32(std::vector<uint8_t>& out, uint32_t v) {
+    put16(out, v & 0xFFFF);
+    put16(out, v >> 16);
+}
+
+static bool writeWav(const char* path, const std::vector<int16_t>& samples) {
+    std::vector<uint8_t> out;
+    uint32_t dataBytes = samples.size() * 2;
+    out.insert(out.end(), { 'R', 'I', 'F', 'F' });
+    put32(out, 36 + dataBytes);
+    out.insert(out.end(), { 'W', 'A', 'V', 'E', 'f', 'm', 't', ' ' });
+    put32(out, 16);
+    put16(out, 1);              // PCM
+    put16(out, 1);              // Mono
+    put32(out, TEST_RATE);
+    put32(out, TEST_RATE * 2);
+    put16(out, 2);
+    put16(out, 16);
+    out.insert(out.end(), { 'd', 'a', 't', 'a' });
+    put32(out, dataBytes);
+    for (int16_t s : samples) {
+        put16(out, (uint16_t)s);
+    }
+
+    FILE* f = fopen(path, "wb");
+    if (f == nullptr) {
+        return false;
+    }
+    bool ok = fwrite(out.data(), 1, out.size(), f) == out.size();
+    return fclose(f) == 0 && ok;
+}
+
+// Exactly on FFT bin 20 (1250 Hz), the middle of band 5
+static std::vector<int16_t> tone(float seconds) {
+    std::vector<int16_t> samples(seconds * TEST_RATE);
+    for (size_t n = 0; n < samples.size(); n++) {
+        samples[n] = (int16_t)(8000 * sin(2 * M_PI * 1250.0 * n / TEST_RATE));
+    }
+    return samples;
+}
+
+// 60 Hz kick with a fast decay on every beat, over a faint constant hiss
+static std::vector<int16_t> kicks(float seconds) {
+    std::vector<int16_t> samples(seconds * TEST_RATE);
+    uint32_t period = TEST_RATE * 60 / KICK_BPM;
+    uint32_t noise = 12345;
+    for (size_t n = 0; n < samples.size(); n++) {
+        float t = (float)(n % period) / TEST_RATE;
+        float kick = t < 0.15f ? 20000 * expf(-t * 25) * sinf(2 * M_PI * 60 * t) : 0;
+        noise = noise * 1103515245 + 12345;
+        samples[n] = (int16_t)(kick + (int16_t)(noise >> 16) / 256);
+    }
+    return samples;
+}
+
+static std::string tempPath(const char* name) {
+    const char* dir = getenv("TMPDIR");
+    return std::string(dir ? dir : "/tmp") + "/" + name;
+}
+
+static void testToneBand() {
+    std::string path = tempPath("lumi_audio_tone.wav");
+    LUMI_CHECK(writeWav(path.c_str(), tone(1.0f)));
+
+    LumiWavSource wav;
+    LUMI_CHECK(wav.open(path.c_str()));
+    LUMI_CHECK_EQ(wav.sampleRate(), TEST_RATE);
+    LumiAudio audio;
+    LUMI_CHECK(audio.begin(wav));
+
+    uint32_t blocks = 0;
+    uint8_t lowest[LUMI_AUDIO_BANDS];
+    uint8_t highest[LUMI_AUDIO_BANDS] = {};
+    memset(lowest, 255, sizeof(lowest));
+    while (!wav.isFinished()) {
+        if (!audio.poll(0)) {
+            continue;
+        }
+        // Skip the blocks in which gain control is still settling
+        if (++blocks < 4) {
+            continue;
+        }
+        const LumiAudioLevels& levels = audio.getLevels();
+        for (uint8_t b = 0; b < LUMI_AUDIO_BANDS; b++) {
+            lowest[b] = min(lowest[b], levels.bands[b]);
+            highest[b] = max(highest[b], levels.bands[b]);
+        }
+        LUMI_CHECK(!levels.beat);
+    }
+    LUMI_CHECK_EQ(blocks, TEST_RATE / LUMI_FFT_SIZE);
+    LUMI_CHECK(lowest[5] >= 250);
+    for (uint8_t b = 0; b < LUMI_AUDIO_BANDS; b++) {
+        if (b != 5) {
+            LUMI_CHECK_EQ(highest[b], 0);
+        }
+    }
+    remove(path.c_str());
+}
+
+static void testKickTempo() {
+    std::string path = tempPath("lumi_audio_kick.wav");
+    LUMI_CHECK(writeWav(path.c_str(), kicks(10.0f)));
+
+    LumiWavSource wav;
+    LUMI_CHECK(wav.open(path.c_str()));
+    LumiAudio audio;
+    LUMI_CHECK(audio.begin(wav));
+
+    // The analysis runs faster than real time; beats are timed on the audio position
+    uint32_t beats = 0;
+    uint32_t lastBeatBlock = 0;
+    uint32_t block = 0;
+    bool evenSpacing = true;
+    while (!wav.isFinished()) {
+        if (!audio.poll(0)) {
+            continue;
+        }
+        block++;
+        if (audio.getLevels().beat) {
+            // 500 ms is 31.25 blocks of 16 ms
+            if (beats > 0 && (block - lastBeatBlock < 30 || block - lastBeatBlock > 33)) {
+                evenSpacing = false;
+            }
+            beats++;
+            lastBeatBlock = block;
+        }
+    }
+    LUMI_CHECK_EQ(beats, 10 * KICK_BPM / 60);
+    LUMI_CHECK(evenSpacing);
+    uint16_t bpm = audio.getLevels().bpm;
+    LUMI_CHECK(bpm >= KICK_BPM - 3 && bpm <= KICK_BPM + 3);
+    remove(path.c_str());
+}
+
+static uint32_t lastFrameSum = 0;
+
+static void onFrame(const CRGB* frame, uint16_t count, uint8_t brightness) {
+    lastFrameSum = 0;
+    for (uint16_t i = 0; i < count; i++) {
+        lastFrameSum += frame[i].r + frame[i].g + frame[i].b;
+    }
+}
+
+static void testAudioMode() {
+    std::string path = tempPath("lumi_audio_mode.wav");
+    LUMI_CHECK(writeWav(path.c_str(), kicks(4.0f)));
+
+    FastLED.reset();
+    lumiHostSetMicros(0);
+    AvantLumi lumi(5, TEST_LEDS);
+    LUMI_CHECK(lumi.begin());
+    lumi.setPalette("ocean");
+    lumi.setFrameCallback(onFrame);
+
+    LUMI_CHECK(!lumi.isAudioActive());
+    LUMI_CHECK_EQ(lumi.getAudioLevels().level, 0);
+
+    LumiWavSource wav;
+    LUMI_CHECK(wav.open(path.c_str()));
+    LUMI_CHECK(lumi.beginAudio(wav));
+
+    // About one analysis block per frame. A beat flashes the strip to full
+    // scale; between kicks only the hiss is left and the strip dims.
+    uint32_t beats = 0;
+    uint32_t beatSum = 0;
+    uint32_t quietSum = UINT32_MAX;
+    for (int i = 0; i < 400 && !wav.isFinished(); i++) {
+        lumi.update();
+        LumiAudioLevels levels = lumi.getAudioLevels();
+        if (levels.beat) {
+            beats++;
+            beatSum = max(beatSum, lastFrameSum);
+        } else if (i > 60) {
+            quietSum = min(quietSum, lastFrameSum);
+        }
+        lumiHostAdvanceMs(16);
+    }
+    LUMI_CHECK(lumi.isAudioActive());
+    LUMI_CHECK(beats >= 6);
+    uint16_t bpm = lumi.getAudioLevels().bpm;
+    LUMI_CHECK(bpm >= KICK_BPM - 3 && bpm <= KICK_BPM + 3);
+    LUMI_CHECK(beatSum > quietSum + quietSum / 2);
+
+    // Past the end of the file the source goes quiet and audio mode times out
+    for (int i = 0; i < 50; i++) {
+        lumi.update();
+        lumiHostAdvanceMs(16);
+    }
+    LUMI_CHECK(!lumi.isAudioActive());
+
+    // Without audio the analyzer is gone and the strip renders at full scale again
+    lumi.endAudio();
+    LUMI_CHECK(!lumi.isAudioActive());
+    LUMI_CHECK_EQ(lumi.getAudioLevels().bpm, 0);
+    for (int i = 0; i < 20; i++) {
+        lumi.update();
+        lumiHostAdvanceMs(16);
+    }
+    LUMI_CHECK(lastFrameSum > quietSum * 4);
+    remove(path.c_str());
+}
+
+int main() {
+    testToneBand();
+    testKickTempo();
+    testAudioMode();
+    return lumiTestResult("audio");
+}
@@ -0,0 +1,186 @@
+/*
+ * AvantLumi Library - Command Coalescing Tests
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * With coalescing on, setter calls between two frames only record their
+ * value. The next update() must apply the last value written to each field
+ * once, the received and applied counters must count exactly that, and a
+ * flood of calls must not grow the instance or allocate.
+ */
+
+#include <AvantLumi.h>
+#include <LumiHost.h>
+#include "lumi_test.h"
+
+#define TEST_LEDS 30
+
+static void testLastWriterWins() {
+    FastLED.reset();
+    AvantLumi lumi(5, TEST_LEDS);
+    LUMI_CHECK(lumi.begin());
+    lumi.setBright(1);
+    lumi.setPalette("ocean");
+    lumi.setFade(false);
+    lumi.setCoalescing(true);
+    LUMI_CHECK(lumi.getCoalescing());
+    lumi.update();
+    LumiCommandStats before = lumi.getCommandStats();
+
+    LUMI_CHECK(lumi.setBright(2));
+    LUMI_CHECK(lumi.setBright(4));
+    LUMI_CHECK(lumi.setRGB(1, 2, 3));
+    LUMI_CHECK(lumi.setPalette("lava"));
+    LUMI_CHECK(lumi.setColor("blue"));
+    lumi.setFade(true);
+    LUMI_CHECK(!lumi.setBright(9));       // Rejected before it is queued
+    LUMI_CHECK(!lumi.setBlendSpeed(0));
+
+    // Nothing changes before the frame
+    LumiCommandStats stats = lumi.getCommandStats();
+    LUMI_CHECK_EQ(stats.received - before.received, 6);
+    LUMI_CHECK_EQ(stats.applied - before.applied, 0);
+    LUMI_CHECK_EQ(stats.pendingFields, 3);  // Brightness, look, fade
+    LUMI_CHECK_EQ(lumi.getBright(), 1);
+    LUMI_CHECK(lumi.getPalette() == "ocean");
+    LUMI_CHECK(!lumi.getFade());
+
+    // One apply per field, with its last value; color and palette share a slot
+    lumi.update();
+    stats = lumi.getCommandStats();
+    LUMI_CHECK_EQ(stats.applied - before.applied, 3);
+    LUMI_CHECK_EQ(stats.pendingFields, 0);
+    LUMI_CHECK_EQ(lumi.getBright(), 4);
+    LUMI_CHECK(lumi.getColor() == "blue");
+    LUMI_CHECK_EQ(lumi.getPaletteId(), LUMI_PALETTE_SOLID);
+    LUMI_CHECK(lumi.getFade());
+
+    // A palette after a color wins the shared slot the other way round
+    lumi.setRGB(9, 9, 9);
+    lumi.setPalette("forest");
+    lumi.update();
+    LUMI_CHECK(lumi.getPalette() == "forest");
+
+    // Turning coalescing off applies what is pending at once
+    lumi.setBlendSpeed(5);
+    lumi.setSwitch(false);
+    LUMI_CHECK_EQ(lumi.getCommandStats().pendingFields, 2);
+    lumi.setCoalescing(false);
+    LUMI_CHECK_EQ(lumi.getCommandStats().pendingFields, 0);
+    LUMI_CHECK_EQ(lumi.getBlendSpeed(), 5);
+    LUMI_CHECK(!lumi.getSwitch());
+
+    // Without coalescing, setters apply directly and are not counted
+    stats = lumi.getCommandStats();
+    lumi.setBright(3);
+    LUMI_CHECK_EQ(lumi.getBright(), 3);
+    LUMI_CHECK_EQ(lumi.getCommandStats().received, stats.received);
+}
+
+static void testFlushAndRecall() {
+    EEPROM.erase();
+    FastLED.reset();
+    AvantLumi lumi(5, TEST_LEDS);
+    LUMI_CHECK(lumi.begin());
+    lumi.setPalette("party");
+    lumi.setBright(2);
+    LUMI_CHECK(lumi.savePreset(0, "party"));
+    lumi.setCoalescing(true);
+
+    lumi.setBright(5);
+    lumi.flushCommands();
+    LUMI_CHECK_EQ(lumi.getBright(), 5);
+
+    // A recall drops what was queued before it; only its own palette is
+    // left for the next frame
+    lumi.setBright(4);
+    lumi.setPalette("lava");
+    LUMI_CHECK(lumi.recallPreset(0));
+    LUMI_CHECK_EQ(lumi.getCommandStats().pendingFields, 1);
+    LUMI_CHECK_EQ(lumi.getBright(), 2);
+    lumi.update();
+    LUMI_CHECK_EQ(lumi.getBright(), 2);
+    LUMI_CHECK(lumi.getPalette() == "party");
+}
+
+// xorshift32: the same flood on every run
+static uint32_t nextRandom(uint32_t& state) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+static void testFlood() {
+    static const char* const palettes[] = { "ocean", "forest", "lava", "party", "heat" };
+    FastLED.reset();
+    lumiHostSetMicros(0);
+    AvantLumi lumi(5, TEST_LEDS);
+    LUMI_CHECK(lumi.begin());
+    lumi.setCoalescing(true);
+    lumi.update();
+    LumiMemoryStats memory = lumi.getMemoryStats();
+    LumiCommandStats before = lumi.getCommandStats();
+
+    uint32_t seed = 12345;
+    uint32_t calls = 0;
+    uint32_t maxApplied = 0;
+    for (int frame = 0; frame < 50; frame++) {
+        // Last value written to each field this frame; 0 = not written
+        uint8_t bright = 0, speed = 0;
+        int look = -1;
+        int fade = -1;
+        for (int i = 0; i < 2000; i++) {
+            uint32_t r = nextRandom(seed);
+            uint8_t value = (r >> 8) % 5;
+            switch (r % 4) {
+                case 0:
+                    lumi.setBright(value + 1);
+                    bright = value + 1;
+                    break;
+                case 1:
+                    lumi.setBlendSpeed(value + 1);
+                    speed = value + 1;
+                    break;
+                case 2:
+                    lumi.setPalette(palettes[value]);
+                    look = value;
+                    break;
+                default:
+                    lumi.setFade(value & 1);
+                    fade = value & 1;
+                    break;
+            }
+            calls++;
+        }
+        LUMI_CHECK(lumi.getCommandStats().pendingFields <= 4);
+
+        uint32_t applied = lumi.getCommandStats().applied;
+        lumi.update();
+        lumiHostAdvanceMs(16);
+        maxApplied = max(maxApplied, lumi.getCommandStats().applied - applied);
+
+        LUMI_CHECK_EQ(lumi.getBright(), bright);
+        LUMI_CHECK_EQ(lumi.getBlendSpeed(), speed);
+        LUMI_CHECK(lumi.getPalette() == palettes[look]);
+        LUMI_CHECK_EQ(lumi.getFade(), fade);
+    }
+
+    // Every call counted, at most one apply per field per frame, nothing grew
+    LumiCommandStats stats = lumi.getCommandStats();
+    LUMI_CHECK_EQ(stats.received - before.received, calls);
+    LUMI_CHECK_EQ(maxApplied, 4);
+    LUMI_CHECK(stats.applied - before.applied <= 50 * 4);
+    LUMI_CHECK_EQ(stats.pendingFields, 0);
+    LumiMemoryStats after = lumi.getMemoryStats();
+    LUMI_CHECK_EQ(after.instanceBytes, memory.instanceBytes);
+    LUMI_CHECK_EQ(after.allocations, memory.allocations);
+}
+
+int main() {
+    testLastWriterWins();
+    testFlushAndRecall();
+    testFlood();
+    return lumiTestResult("coalesce");
+}
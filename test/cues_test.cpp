@@ -0,0 +1,131 @@
+/*
+ * AvantLumi Library - Cue Scheduler and Idle Wake Tests
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * Cues that come due while the caller sleeps past them must still fire, and
+ * a coalesced command must wake an idle strip so update() flushes it. The
+ * scheduler itself only exists once cues are started.
+ */
+
+#include <AvantLumi.h>
+#include <LumiHost.h>
+#include "lumi_test.h"
+
+static const time_t MONDAY_10AM = 1754301600;   // 2025-08-04 10:00:00 UTC
+
+static time_t wallClock = MONDAY_10AM;
+
+static time_t testClock() {
+    return wallClock;
+}
+
+static void testCueAfterLongSleep() {
+    LumiCueScheduler cues;
+    LUMI_CHECK(cues.begin(4));
+    cues.setClock(testClock);
+    int noon = cues.addCue(12, 0, 0, LUMI_CUE_EVERY_DAY, LUMI_CUE_BRIGHT, 5);
+    int evening = cues.addCue(20, 0, 0, LUMI_CUE_EVERY_DAY, LUMI_CUE_SWITCH, 0);
+
+    LumiCue due;
+    wallClock = MONDAY_10AM;
+    LUMI_CHECK(!cues.poll(wallClock, due));
+    LUMI_CHECK_EQ(cues.nextFireTime(), MONDAY_10AM + 2 * 3600);
+
+    // Slept through noon: the jump is over an hour, the noon cue still fires once
+    wallClock = MONDAY_10AM + 2 * 3600 + 1800;
+    LUMI_CHECK(cues.poll(wallClock, due));
+    LUMI_CHECK_EQ(due.id, noon);
+    LUMI_CHECK(!cues.poll(wallClock, due));
+    LUMI_CHECK_EQ(cues.nextFireTime(), MONDAY_10AM + 10 * 3600);
+
+    // Slept through the evening cue and tomorrow's noon: both fire, oldest first
+    wallClock = MONDAY_10AM + 26 * 3600 + 60;
+    LUMI_CHECK(cues.poll(wallClock, due));
+    LUMI_CHECK_EQ(due.id, evening);
+    LUMI_CHECK(cues.poll(wallClock, due));
+    LUMI_CHECK_EQ(due.id, noon);
+    LUMI_CHECK(!cues.poll(wallClock, due));
+
+    // Stepping back does not replay anything
+    wallClock = MONDAY_10AM;
+    LUMI_CHECK(!cues.poll(wallClock, due));
+    LUMI_CHECK_EQ(cues.nextFireTime(), MONDAY_10AM + 2 * 3600);
+}
+
+static void testCueFiresOnIdleStrip() {
+    FastLED.reset();
+    AvantLumi lumi(5, 30);
+    LUMI_CHECK(lumi.begin());
+    LUMI_CHECK(lumi.setFade(false));
+    LUMI_CHECK(lumi.setPalette("ocean"));
+    LUMI_CHECK(lumi.beginCues(4));
+    lumi.setCueClock(testClock);
+    wallClock = MONDAY_10AM;
+    LUMI_CHECK(lumi.addCue(12, 0, 0, LUMI_CUE_EVERY_DAY, LUMI_CUE_BRIGHT, 5) >= 0);
+
+    for (int i = 0; i < 1000 && !lumi.isIdle(); i++) {
+        lumi.update();
+        lumiHostAdvanceMs(20);
+    }
+    LUMI_CHECK(lumi.isIdle());
+    LUMI_CHECK_EQ(lumi.getIdleSleepMs(), 2 * 3600 * 1000UL);
+
+    // Sleeping a little too long must not lose the cue
+    wallClock = MONDAY_10AM + 2 * 3600 + 5;
+    lumiHostAdvanceMs(2 * 3600 * 1000UL + 5000);
+    lumi.update();
+    LUMI_CHECK_EQ(lumi.getBright(), 5);
+    LUMI_CHECK(!lumi.isIdle());
+}
+
+static void testQueuedCommandWakes() {
+    FastLED.reset();
+    AvantLumi lumi(5, 30);
+    LUMI_CHECK(lumi.begin());
+    LUMI_CHECK(lumi.setFade(false));
+    LUMI_CHECK(lumi.setPalette("ocean"));
+    for (int i = 0; i < 1000 && !lumi.isIdle(); i++) {
+        lumi.update();
+        lumiHostAdvanceMs(20);
+    }
+    LUMI_CHECK(lumi.isIdle());
+
+    lumi.setCoalescing(true);
+    LUMI_CHECK(lumi.setBright(1));
+    LUMI_CHECK(!lumi.isIdle());
+    LUMI_CHECK_EQ(lumi.getIdleSleepMs(), 0);
+    lumi.update();
+    LUMI_CHECK_EQ(lumi.getBright(), 1);
+}
+
+static void testSchedulerCreatedOnUse() {
+    FastLED.reset();
+    AvantLumi lumi(5, 30);
+    LUMI_CHECK(lumi.begin());
+
+    // Without a scheduler cues are refused and nothing is polled
+    uint32_t before = lumi.getMemoryStats().instanceBytes;
+    LUMI_CHECK_EQ(lumi.addCue(10, 0, 0, LUMI_CUE_EVERY_DAY, LUMI_CUE_SWITCH, 0), -1);
+    LUMI_CHECK_EQ(lumi.getCueCount(), 0);
+    LUMI_CHECK_EQ(lumi.getNextCueTime(), 0);
+    LUMI_CHECK(!lumi.removeCue(0));
+    LUMI_CHECK_EQ(lumi.getMemoryStats().instanceBytes, before);
+
+    lumi.setCueClock(testClock);
+    LUMI_CHECK(lumi.beginCues(2));
+    LUMI_CHECK(lumi.getMemoryStats().instanceBytes >= before + sizeof(LumiCueScheduler));
+    LUMI_CHECK(lumi.addCue(10, 0, 0, LUMI_CUE_EVERY_DAY, LUMI_CUE_SWITCH, 0) >= 0);
+    LUMI_CHECK_EQ(lumi.getCueCount(), 1);
+}
+
+int main() {
+    setenv("TZ", "UTC0", 1);
+    tzset();
+    testCueAfterLongSleep();
+    testCueFiresOnIdleStrip();
+    testQueuedCommandWakes();
+    testSchedulerCreatedOnUse();
+    return lumiTestResult("cues_test");
+}
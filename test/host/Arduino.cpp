@@ -0,0 +1,320 @@
+/*
+ * AvantLumi Library - Host Test Shim: Arduino core Implementation
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ */
+
+#include "Arduino.h"
+#include "EEPROM.h"
+#include "LumiHost.h"
+
+// ================================
+// Simulated clock and pins
+// ================================
+static uint64_t simMicros = 0;
+static int pinStates[256];
+static bool pinStatesReady = false;
+
+unsigned long millis() {
+    return (unsigned long)(uint32_t)(simMicros / 1000);
+}
+
+unsigned long micros() {
+    return (unsigned long)(uint32_t)simMicros;
+}
+
+void delay(unsigned long ms) {
+    simMicros += (uint64_t)ms * 1000;
+}
+
+void delayMicroseconds(unsigned int us) {
+    simMicros += us;
+}
+
+void lumiHostSetMicros(uint64_t us) {
+    simMicros = us;
+}
+
+uint64_t lumiHostMicros() {
+    return simMicros;
+}
+
+void lumiHostAdvanceMs(uint32_t ms) {
+    simMicros += (uint64_t)ms * 1000;
+}
+
+void lumiHostAdvanceUs(uint32_t us) {
+    simMicros += us;
+}
+
+static void initPins() {
+    if (!pinStatesReady) {
+        for (int i = 0; i < 256; i++) {
+            pinStates[i] = -1;
+        }
+        pinStatesReady = true;
+    }
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    (void)pin;
+    (void)mode;
+    initPins();
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    initPins();
+    pinStates[pin] = value ? HIGH : LOW;
+}
+
+int digitalRead(uint8_t pin) {
+    initPins();
+    return pinStates[pin] < 0 ? LOW : pinStates[pin];
+}
+
+int lumiHostPin(uint8_t pin) {
+    initPins();
+    return pinStates[pin];
+}
+
+// ================================
+// String
+// ================================
+String::String(float value, unsigned int decimals) {
+    char buffer[48];
+    snprintf(buffer, sizeof(buffer), "%.*f", (int)decimals, (double)value);
+    text = buffer;
+}
+
+String::String(double value, unsigned int decimals) {
+    char buffer[48];
+    snprintf(buffer, sizeof(buffer), "%.*f", (int)decimals, value);
+    text = buffer;
+}
+
+void String::trim() {
+    size_t first = 0;
+    while (first < text.size() && isspace((unsigned char)text[first])) {
+        first++;
+    }
+    size_t last = text.size();
+    while (last > first && isspace((unsigned char)text[last - 1])) {
+        last--;
+    }
+    text = text.substr(first, last - first);
+}
+
+void String::toLowerCase() {
+    for (size_t i = 0; i < text.size(); i++) {
+        text[i] = tolower((unsigned char)text[i]);
+    }
+}
+
+void String::toUpperCase() {
+    for (size_t i = 0; i < text.size(); i++) {
+        text[i] = toupper((unsigned char)text[i]);
+    }
+}
+
+int String::indexOf(char c, unsigned int from) const {
+    size_t pos = text.find(c, from);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::indexOf(const char* s, unsigned int from) const {
+    size_t pos = text.find(s, from);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+String String::substring(unsigned int from) const {
+    return from >= text.size() ? String() : String(text.substr(from));
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+    if (from > to) {
+        std::swap(from, to);
+    }
+    if (from >= text.size()) {
+        return String();
+    }
+    return String(text.substr(from, to - from));
+}
+
+bool String::equalsIgnoreCase(const String& other) const {
+    return text.size() == other.text.size() && strcasecmp(text.c_str(), other.text.c_str()) == 0;
+}
+
+// ================================
+// EEPROM
+// ================================
+EEPROMClass EEPROM;
+
+EEPROMClass::EEPROMClass() {
+    size = 0;
+    commits = 0;
+    erase();
+}
+
+bool EEPROMClass::begin(size_t bytes) {
+    if (bytes > LUMI_HOST_EEPROM_SIZE) {
+        return false;
+    }
+    size = bytes;
+    return true;
+}
+
+bool EEPROMClass::commit() {
+    commits++;
+    return size > 0;
+}
+
+uint8_t EEPROMClass::read(int address) {
+    return (address >= 0 && (size_t)address < size) ? data[address] : 0;
+}
+
+void EEPROMClass::write(int address, uint8_t value) {
+    if (address >= 0 && (size_t)address < size) {
+        data[address] = value;
+    }
+}
+
+void EEPROMClass::erase() {
+    memset(data, 0xFF, sizeof(data));
+}
+
+// ================================
+// Loopback UDP
+// ================================
+LoopbackNetwork::LoopbackNetwork() {
+    latencyUs = 0;
+    sent = 0;
+}
+
+void LoopbackNetwork::attach(LoopbackUdp* socket) {
+    sockets.push_back(socket);
+}
+
+void LoopbackNetwork::detach(LoopbackUdp* socket) {
+    sockets.erase(std::remove(sockets.begin(), sockets.end(), socket), sockets.end());
+}
+
+void LoopbackNetwork::deliver(LoopbackUdp* from, IPAddress to, uint16_t port, const std::vector<uint8_t>& data) {
+    static const IPAddress broadcast(255, 255, 255, 255);
+    sent++;
+    for (LoopbackUdp* socket : sockets) {
+        if (socket == from || !socket->bound || socket->localPort != port) {
+            continue;
+        }
+        if (to != broadcast && to != socket->address) {
+            continue;
+        }
+        LoopbackUdp::Packet packet;
+        packet.data = data;
+        packet.from = from->address;
+        packet.fromPort = from->bound ? from->localPort : 0;
+        packet.deliverAt = lumiHostMicros() + latencyUs;
+        socket->queue.push_back(packet);
+    }
+}
+
+LoopbackUdp::LoopbackUdp(LoopbackNetwork& net, IPAddress ip) : network(net), address(ip) {
+    localPort = 0;
+    bound = false;
+    cursor = 0;
+    outgoingPort = 0;
+    network.attach(this);
+}
+
+LoopbackUdp::~LoopbackUdp() {
+    network.detach(this);
+}
+
+uint8_t LoopbackUdp::begin(uint16_t port) {
+    localPort = port;
+    bound = true;
+    queue.clear();
+    return 1;
+}
+
+void LoopbackUdp::stop() {
+    bound = false;
+    queue.clear();
+    current.data.clear();
+    cursor = 0;
+}
+
+int LoopbackUdp::beginPacket(IPAddress ip, uint16_t port) {
+    outgoing.clear();
+    outgoingTo = ip;
+    outgoingPort = port;
+    return 1;
+}
+
+int LoopbackUdp::beginPacket(const char* host, uint16_t port) {
+    (void)host;
+    return beginPacket(IPAddress(255, 255, 255, 255), port);
+}
+
+int LoopbackUdp::endPacket() {
+    network.deliver(this, outgoingTo, outgoingPort, outgoing);
+    outgoing.clear();
+    return 1;
+}
+
+size_t LoopbackUdp::write(uint8_t value) {
+    outgoing.push_back(value);
+    return 1;
+}
+
+size_t LoopbackUdp::write(const uint8_t* buffer, size_t size) {
+    outgoing.insert(outgoing.end(), buffer, buffer + size);
+    return size;
+}
+
+int LoopbackUdp::parsePacket() {
+    // Whatever is left of the previous packet is discarded, as on the real stacks
+    if (queue.empty() || queue.front().deliverAt > lumiHostMicros()) {
+        current.data.clear();
+        cursor = 0;
+        return 0;
+    }
+    current = queue.front();
+    queue.pop_front();
+    cursor = 0;
+    return (int)current.data.size();
+}
+
+int LoopbackUdp::available() {
+    return (int)(current.data.size() - cursor);
+}
+
+int LoopbackUdp::read() {
+    return cursor < current.data.size() ? current.data[cursor++] : -1;
+}
+
+int LoopbackUdp::read(unsigned char* buffer, size_t len) {
+    size_t count = min(len, current.data.size() - cursor);
+    memcpy(buffer, current.data.data() + cursor, count);
+    cursor += count;
+    return (int)count;
+}
+
+int LoopbackUdp::read(char* buffer, size_t len) {
+    return read((unsigned char*)buffer, len);
+}
+
+int LoopbackUdp::peek() {
+    return cursor < current.data.size() ? current.data[cursor] : -1;
+}
+
+void LoopbackUdp::flush() {
+}
+
+IPAddress LoopbackUdp::remoteIP() {
+    return current.from;
+}
+
+uint16_t LoopbackUdp::remotePort() {
+    return current.fromPort;
+}
@@ -0,0 +1,116 @@
+/*
+ * AvantLumi Library - Host Test Shim: Arduino core
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * Just enough of the Arduino core to build the library on a PC. millis() and
+ * micros() read a simulated clock that only moves when a test advances it
+ * (see LumiHost.h), so every run of a test sees exactly the same timing.
+ */
+
+#ifndef LUMI_HOST_ARDUINO_H
+#define LUMI_HOST_ARDUINO_H
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <string>
+#include <algorithm>
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define PROGMEM
+#define F(x) x
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+using std::min;
+using std::max;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+
+class String {
+private:
+    std::string text;
+
+    String(const std::string& s) : text(s) {}
+
+public:
+    String() {}
+    String(const char* s) : text(s ? s : "") {}
+    String(const String& other) = default;
+    explicit String(char c) : text(1, c) {}
+    String(int value) : text(std::to_string(value)) {}
+    String(unsigned int value) : text(std::to_string(value)) {}
+    String(long value) : text(std::to_string(value)) {}
+    String(unsigned long value) : text(std::to_string(value)) {}
+    String(float value, unsigned int decimals = 2);
+    String(double value, unsigned int decimals = 2);
+
+    String& operator=(const String& other) = default;
+
+    unsigned int length() const { return text.size(); }
+    const char* c_str() const { return text.c_str(); }
+    bool reserve(unsigned int size) { text.reserve(size); return true; }
+    char charAt(unsigned int index) const { return index < text.size() ? text[index] : 0; }
+    char operator[](unsigned int index) const { return charAt(index); }
+
+    void remove(unsigned int index) { if (index < text.size()) text.erase(index); }
+    void trim();
+    void toLowerCase();
+    void toUpperCase();
+    int indexOf(char c, unsigned int from = 0) const;
+    int indexOf(const char* s, unsigned int from = 0) const;
+    String substring(unsigned int from) const;
+    String substring(unsigned int from, unsigned int to) const;
+    bool startsWith(const String& prefix) const { return text.compare(0, prefix.text.size(), prefix.text) == 0; }
+    bool equals(const String& other) const { return text == other.text; }
+    bool equalsIgnoreCase(const String& other) const;
+    long toInt() const { return atol(text.c_str()); }
+    bool isEmpty() const { return text.empty(); }
+
+    bool concat(const char* s, unsigned int length) { text.append(s, length); return true; }
+    String& operator+=(const String& other) { text += other.text; return *this; }
+    String& operator+=(const char* s) { text += s; return *this; }
+    String& operator+=(char c) { text += c; return *this; }
+
+    bool operator==(const String& other) const { return text == other.text; }
+    bool operator==(const char* s) const { return text == s; }
+    bool operator!=(const String& other) const { return text != other.text; }
+    bool operator!=(const char* s) const { return text != s; }
+
+    friend String operator+(const String& a, const String& b) { return String(a.text + b.text); }
+    friend String operator+(const String& a, const char* b) { return String(a.text + b); }
+    friend String operator+(const char* a, const String& b) { return String(a + b.text); }
+    friend String operator+(const String& a, char b) { return String(a.text + b); }
+};
+
+// IPv4 address as used by the UDP classes
+class IPAddress {
+private:
+    uint8_t bytes[4];
+
+public:
+    IPAddress() : bytes{0, 0, 0, 0} {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : bytes{a, b, c, d} {}
+    uint8_t operator[](int index) const { return bytes[index]; }
+    bool operator==(const IPAddress& other) const { return memcmp(bytes, other.bytes, 4) == 0; }
+    bool operator!=(const IPAddress& other) const { return !(*this == other); }
+};
+
+#endif // LUMI_HOST_ARDUINO_H
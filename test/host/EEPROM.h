@@ -0,0 +1,54 @@
+/*
+ * AvantLumi Library - Host Test Shim: EEPROM
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * RAM-backed emulated EEPROM with the ESP32 begin()/commit() interface.
+ * Contents start erased (0xFF) and live until the process exits.
+ */
+
+#ifndef LUMI_HOST_EEPROM_H
+#define LUMI_HOST_EEPROM_H
+
+#include "Arduino.h"
+
+#define LUMI_HOST_EEPROM_SIZE 4096
+
+class EEPROMClass {
+private:
+    uint8_t data[LUMI_HOST_EEPROM_SIZE];
+    size_t size;
+    uint32_t commits;
+
+public:
+    EEPROMClass();
+
+    bool begin(size_t bytes);
+    bool commit();
+    uint8_t read(int address);
+    void write(int address, uint8_t value);
+    size_t length() { return size; }
+
+    template<typename T> T& get(int address, T& t) {
+        if (address >= 0 && address + sizeof(T) <= size) {
+            memcpy((void*)&t, data + address, sizeof(T));
+        }
+        return t;
+    }
+
+    template<typename T> const T& put(int address, const T& t) {
+        if (address >= 0 && address + sizeof(T) <= size) {
+            memcpy(data + address, (const void*)&t, sizeof(T));
+        }
+        return t;
+    }
+
+    // Host only
+    uint32_t getCommitCount() { return commits; }
+    void erase();
+};
+
+extern EEPROMClass EEPROM;
+
+#endif // LUMI_HOST_EEPROM_H
@@ -0,0 +1,387 @@
+/*
+ * AvantLumi Library - Host Test Shim: FastLED Implementation
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ */
+
+#include "FastLED.h"
+
+CFastLED FastLED;
+
+// ================================
+// 8-bit math
+// ================================
+uint8_t scale8(uint8_t i, fract8 scale) {
+    return ((uint16_t)i * (1 + (uint16_t)scale)) >> 8;   // FASTLED_SCALE8_FIXED
+}
+
+uint8_t scale8_video(uint8_t i, fract8 scale) {
+    return (((int)i * (int)scale) >> 8) + ((i && scale) ? 1 : 0);
+}
+
+uint8_t sin8(uint8_t theta) {
+    static const uint8_t interleave[] = { 0, 49, 49, 41, 90, 27, 117, 10 };
+    uint8_t offset = theta;
+    if (theta & 0x40) {
+        offset = (uint8_t)255 - offset;
+    }
+    offset &= 0x3F;
+
+    uint8_t secoffset = offset & 0x0F;
+    if (theta & 0x40) {
+        secoffset++;
+    }
+
+    uint8_t section = offset >> 4;
+    uint8_t b = interleave[section * 2];
+    uint8_t m16 = interleave[section * 2 + 1];
+    uint8_t mx = (m16 * secoffset) >> 4;
+
+    int8_t y = mx + b;
+    if (theta & 0x80) {
+        y = -y;
+    }
+    return (uint8_t)(y + 128);
+}
+
+uint8_t cos8(uint8_t theta) {
+    return sin8(theta + 64);
+}
+
+uint8_t blend8(uint8_t a, uint8_t b, uint8_t amountOfB) {
+    uint16_t partial = (a << 8) | b;
+    partial += (b * amountOfB);
+    partial -= (a * amountOfB);
+    return partial >> 8;
+}
+
+uint8_t qadd8(uint8_t i, uint8_t j) {
+    unsigned int t = i + j;
+    return t > 255 ? 255 : t;
+}
+
+uint8_t qsub8(uint8_t i, uint8_t j) {
+    return i > j ? i - j : 0;
+}
+
+// ================================
+// Random numbers (FastLED's 16-bit LCG)
+// ================================
+static uint16_t rand16seed = 1337;
+
+uint8_t random8() {
+    rand16seed = (rand16seed * 2053) + 13849;
+    return (uint8_t)(((uint8_t)(rand16seed & 0xFF)) + ((uint8_t)(rand16seed >> 8)));
+}
+
+uint8_t random8(uint8_t lim) {
+    return (random8() * lim) >> 8;
+}
+
+uint8_t random8(uint8_t min, uint8_t lim) {
+    return random8(lim - min) + min;
+}
+
+uint16_t random16() {
+    rand16seed = (rand16seed * 2053) + 13849;
+    return rand16seed;
+}
+
+void random16_set_seed(uint16_t seed) {
+    rand16seed = seed;
+}
+
+uint16_t random16_get_seed() {
+    return rand16seed;
+}
+
+void random16_add_entropy(uint16_t entropy) {
+    rand16seed += entropy;
+}
+
+// ================================
+// Colors
+// ================================
+void hsv2rgb_rainbow(const CHSV& hsv, CRGB& rgb) {
+    uint8_t hue = hsv.h;
+    uint8_t sat = hsv.s;
+    uint8_t val = hsv.v;
+
+    uint8_t offset8 = (hue & 0x1F) << 3;
+    uint8_t third = scale8(offset8, 85);
+    uint8_t twothirds = scale8(offset8, 170);
+    uint8_t r, g, b;
+
+    // Eight 32-step sections: R, O, Y, G, A, B, P, K
+    switch (hue >> 5) {
+        case 0:  r = 255 - third; g = third;            b = 0;                break;
+        case 1:  r = 171;         g = 85 + third;       b = 0;                break;
+        case 2:  r = 171 - twothirds; g = 170 + third;  b = 0;                break;
+        case 3:  r = 0;           g = 255 - third;      b = third;            break;
+        case 4:  r = 0;           g = 171 - twothirds;  b = 85 + twothirds;   break;
+        case 5:  r = third;       g = 0;                b = 255 - third;      break;
+        case 6:  r = 85 + third;  g = 0;                b = 171 - third;      break;
+        default: r = 170 + third; g = 0;                b = 85 - third;       break;
+    }
+
+    if (sat != 255) {
+        if (sat == 0) {
+            r = g = b = 255;
+        } else {
+            uint8_t desat = 255 - sat;
+            desat = scale8(desat, desat);
+            uint8_t satscale = 255 - desat;
+            r = scale8(r, satscale) + desat;
+            g = scale8(g, satscale) + desat;
+            b = scale8(b, satscale) + desat;
+        }
+    }
+
+    if (val != 255) {
+        val = scale8_video(val, val);
+        r = scale8(r, val);
+        g = scale8(g, val);
+        b = scale8(b, val);
+    }
+    rgb = CRGB(r, g, b);
+}
+
+CRGB& CRGB::nscale8(uint8_t scaledown) {
+    r = scale8(r, scaledown);
+    g = scale8(g, scaledown);
+    b = scale8(b, scaledown);
+    return *this;
+}
+
+CRGB& CRGB::nscale8_video(uint8_t scaledown) {
+    r = scale8_video(r, scaledown);
+    g = scale8_video(g, scaledown);
+    b = scale8_video(b, scaledown);
+    return *this;
+}
+
+CRGB blend(const CRGB& p1, const CRGB& p2, fract8 amountOfP2) {
+    return CRGB(blend8(p1.r, p2.r, amountOfP2),
+                blend8(p1.g, p2.g, amountOfP2),
+                blend8(p1.b, p2.b, amountOfP2));
+}
+
+CRGB* blend(const CRGB* src1, const CRGB* src2, CRGB* dest, uint16_t count, fract8 amountOfsrc2) {
+    for (uint16_t i = 0; i < count; i++) {
+        dest[i] = blend(src1[i], src2[i], amountOfsrc2);
+    }
+    return dest;
+}
+
+void fill_solid(CRGB* leds, int numToFill, const CRGB& color) {
+    for (int i = 0; i < numToFill; i++) {
+        leds[i] = color;
+    }
+}
+
+// ================================
+// Palettes
+// ================================
+const TProgmemRGBPalette16 CloudColors_p = {
+    CRGB::Blue, CRGB::DarkBlue, CRGB::DarkBlue, CRGB::DarkBlue,
+    CRGB::DarkBlue, CRGB::DarkBlue, CRGB::DarkBlue, CRGB::DarkBlue,
+    CRGB::Blue, CRGB::DarkBlue, CRGB::SkyBlue, CRGB::SkyBlue,
+    CRGB::LightBlue, CRGB::White, CRGB::LightBlue, CRGB::SkyBlue
+};
+
+const TProgmemRGBPalette16 LavaColors_p = {
+    CRGB::Black, CRGB::Maroon, CRGB::Black, CRGB::Maroon,
+    CRGB::DarkRed, CRGB::DarkRed, CRGB::Maroon, CRGB::DarkRed,
+    CRGB::DarkRed, CRGB::DarkRed, CRGB::Red, CRGB::Orange,
+    CRGB::White, CRGB::Orange, CRGB::Red, CRGB::DarkRed
+};
+
+const TProgmemRGBPalette16 OceanColors_p = {
+    CRGB::MidnightBlue, CRGB::DarkBlue, CRGB::MidnightBlue, CRGB::Navy,
+    CRGB::DarkBlue, CRGB::MediumBlue, CRGB::SeaGreen, CRGB::Teal,
+    CRGB::CadetBlue, CRGB::Blue, CRGB::DarkCyan, CRGB::CornflowerBlue,
+    CRGB::Aquamarine, CRGB::SeaGreen, CRGB::Aqua, CRGB::LightSkyBlue
+};
+
+const TProgmemRGBPalette16 ForestColors_p = {
+    CRGB::DarkGreen, CRGB::DarkGreen, CRGB::DarkOliveGreen, CRGB::DarkGreen,
+    CRGB::Green, CRGB::ForestGreen, CRGB::OliveDrab, CRGB::Green,
+    CRGB::SeaGreen, CRGB::MediumAquamarine, CRGB::LimeGreen, CRGB::YellowGreen,
+    CRGB::LightGreen, CRGB::LawnGreen, CRGB::MediumAquamarine, CRGB::ForestGreen
+};
+
+const TProgmemRGBPalette16 RainbowColors_p = {
+    0xFF0000, 0xD52A00, 0xAB5500, 0xAB7F00,
+    0xABAB00, 0x56D500, 0x00FF00, 0x00D52A,
+    0x00AB55, 0x0056AA, 0x0000FF, 0x2A00D5,
+    0x5500AB, 0x7F0081, 0xAB0055, 0xD5002B
+};
+
+const TProgmemRGBPalette16 PartyColors_p = {
+    0x5500AB, 0x84007C, 0xB5004B, 0xE5001B,
+    0xE81700, 0xB84700, 0xAB7700, 0xABAB00,
+    0xAB5500, 0xDD2200, 0xF2000E, 0xC2003E,
+    0x8F0071, 0x5F00A1, 0x2F00D0, 0x0007F9
+};
+
+const TProgmemRGBPalette16 HeatColors_p = {
+    0x000000, 0x330000, 0x660000, 0x990000,
+    0xCC0000, 0xFF0000, 0xFF3300, 0xFF6600,
+    0xFF9900, 0xFFCC00, 0xFFFF00, 0xFFFF33,
+    0xFFFF66, 0xFFFF99, 0xFFFFCC, 0xFFFFFF
+};
+
+CRGBPalette16::CRGBPalette16(const CRGB& c00, const CRGB& c01, const CRGB& c02, const CRGB& c03,
+                             const CRGB& c04, const CRGB& c05, const CRGB& c06, const CRGB& c07,
+                             const CRGB& c08, const CRGB& c09, const CRGB& c10, const CRGB& c11,
+                             const CRGB& c12, const CRGB& c13, const CRGB& c14, const CRGB& c15) {
+    entries[0] = c00; entries[1] = c01; entries[2] = c02; entries[3] = c03;
+    entries[4] = c04; entries[5] = c05; entries[6] = c06; entries[7] = c07;
+    entries[8] = c08; entries[9] = c09; entries[10] = c10; entries[11] = c11;
+    entries[12] = c12; entries[13] = c13; entries[14] = c14; entries[15] = c15;
+}
+
+CRGBPalette16::CRGBPalette16(const TProgmemRGBPalette16& rhs) {
+    *this = rhs;
+}
+
+CRGBPalette16& CRGBPalette16::operator=(const TProgmemRGBPalette16& rhs) {
+    for (uint8_t i = 0; i < 16; i++) {
+        entries[i] = CRGB(rhs[i]);
+    }
+    return *this;
+}
+
+// Shortest-hue HSV gradient between two entries, as fill_gradient() does
+static void hsvGradient(CRGB* out, uint8_t startPos, const CHSV& start, uint8_t endPos, const CHSV& end) {
+    int16_t hueDelta = (int16_t)(int8_t)(end.h - start.h);
+    uint8_t steps = endPos - startPos;
+    for (uint8_t i = 0; i <= steps; i++) {
+        CHSV c((uint8_t)(start.h + hueDelta * i / steps),
+               (uint8_t)(start.s + ((int16_t)end.s - start.s) * i / steps),
+               (uint8_t)(start.v + ((int16_t)end.v - start.v) * i / steps));
+        out[startPos + i] = CRGB(c);
+    }
+}
+
+CRGBPalette16::CRGBPalette16(const CHSV& c1, const CHSV& c2, const CHSV& c3, const CHSV& c4) {
+    hsvGradient(entries, 0, c1, 5, c2);
+    hsvGradient(entries, 5, c2, 10, c3);
+    hsvGradient(entries, 10, c3, 15, c4);
+}
+
+bool CRGBPalette16::operator==(const CRGBPalette16& rhs) const {
+    return memcmp(entries, rhs.entries, sizeof(entries)) == 0;
+}
+
+CRGB ColorFromPalette(const CRGBPalette16& pal, uint8_t index, uint8_t brightness, TBlendType blendType) {
+    uint8_t hi4 = index >> 4;
+    uint8_t lo4 = index & 0x0F;
+    const CRGB& entry = pal[hi4];
+    uint8_t red1 = entry.r;
+    uint8_t green1 = entry.g;
+    uint8_t blue1 = entry.b;
+
+    if (lo4 && blendType != NOBLEND) {
+        const CRGB& next = pal[(hi4 + 1) & 0x0F];
+        uint8_t f2 = lo4 << 4;
+        uint8_t f1 = 255 - f2;
+        red1 = scale8(red1, f1) + scale8(next.r, f2);
+        green1 = scale8(green1, f1) + scale8(next.g, f2);
+        blue1 = scale8(blue1, f1) + scale8(next.b, f2);
+    }
+
+    if (brightness != 255) {
+        if (brightness) {
+            brightness++; // Adjust for rounding
+            red1 = red1 ? scale8(red1, brightness) : 0;
+            green1 = green1 ? scale8(green1, brightness) : 0;
+            blue1 = blue1 ? scale8(blue1, brightness) : 0;
+        } else {
+            red1 = green1 = blue1 = 0;
+        }
+    }
+    return CRGB(red1, green1, blue1);
+}
+
+void nblendPaletteTowardPalette(CRGBPalette16& current, CRGBPalette16& target, uint8_t maxChanges) {
+    uint8_t* p1 = (uint8_t*)current.entries;
+    uint8_t* p2 = (uint8_t*)target.entries;
+    uint8_t changes = 0;
+
+    for (uint8_t i = 0; i < sizeof(current.entries); i++) {
+        // Up by one, down by two, until maxChanges channels moved
+        if (p1[i] == p2[i]) {
+            continue;
+        }
+        if (p1[i] < p2[i]) {
+            p1[i]++;
+            changes++;
+        }
+        if (p1[i] > p2[i]) {
+            p1[i]--;
+            changes++;
+            if (p1[i] > p2[i]) {
+                p1[i]--;
+            }
+        }
+        if (changes >= maxChanges) {
+            break;
+        }
+    }
+}
+
+// ================================
+// Controllers
+// ================================
+CFastLED::CFastLED() {
+    reset();
+}
+
+void CFastLED::reset() {
+    for (int i = 0; i < LUMI_HOST_MAX_CONTROLLERS; i++) {
+        controllers[i].setLeds(nullptr, 0);
+    }
+    controllerCount = 0;
+    brightness = 255;
+    maxVolts = 5;
+    maxMilliamps = 0;
+    shows = 0;
+    showHook = nullptr;
+}
+
+CLEDController& CFastLED::addController(CRGB* data, int nLeds) {
+    if (controllerCount == LUMI_HOST_MAX_CONTROLLERS) {
+        fprintf(stderr, "FastLED shim: more than %d controllers\n", LUMI_HOST_MAX_CONTROLLERS);
+        abort();
+    }
+    CLEDController& controller = controllers[controllerCount++];
+    controller.setLeds(data, nLeds);
+    return controller;
+}
+
+void CFastLED::setMaxPowerInVoltsAndMilliamps(uint8_t volts, uint32_t milliamps) {
+    maxVolts = volts;
+    maxMilliamps = milliamps;
+}
+
+void CFastLED::show(uint8_t scale) {
+    shows++;
+    if (showHook) {
+        for (int i = 0; i < controllerCount; i++) {
+            showHook(controllers[i], scale);
+        }
+    }
+}
+
+void CFastLED::clear(bool writeData) {
+    for (int i = 0; i < controllerCount; i++) {
+        if (controllers[i].leds()) {
+            fill_solid(controllers[i].leds(), controllers[i].size(), CRGB::Black);
+        }
+    }
+    if (writeData) {
+        show(0);
+    }
+}
@@ -0,0 +1,235 @@
+/*
+ * AvantLumi Library - Host Test Shim: FastLED
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * The parts of the FastLED API the library uses, with the same signatures as
+ * FastLED 3.6 so code that builds here also builds against the real library.
+ * Color math (sin8, scale8, blend, ColorFromPalette, palette blending and the
+ * random generator) follows FastLED's integer algorithms; CHSV conversion and
+ * HSV gradients are close approximations. Golden frame hashes recorded with
+ * this shim describe the library's output on the host, not on the wire.
+ *
+ * show() does not drive anything. It counts frames and hands every
+ * controller's pixels to an optional hook, which tests use as a transmitter.
+ * With double buffering the library calls show() from its show thread, as
+ * the show task does on ESP32, so the hook runs on that thread.
+ * Power limiting is not modeled.
+ */
+
+#ifndef LUMI_HOST_FASTLED_H
+#define LUMI_HOST_FASTLED_H
+
+#include "Arduino.h"
+#include <atomic>
+
+#define FASTLED_VERSION 3006000
+
+typedef uint8_t fract8;
+
+uint8_t scale8(uint8_t i, fract8 scale);
+uint8_t scale8_video(uint8_t i, fract8 scale);
+uint8_t sin8(uint8_t theta);
+uint8_t cos8(uint8_t theta);
+uint8_t blend8(uint8_t a, uint8_t b, uint8_t amountOfB);
+uint8_t qadd8(uint8_t i, uint8_t j);
+uint8_t qsub8(uint8_t i, uint8_t j);
+
+uint8_t random8();
+uint8_t random8(uint8_t lim);
+uint8_t random8(uint8_t min, uint8_t lim);
+uint16_t random16();
+void random16_set_seed(uint16_t seed);
+uint16_t random16_get_seed();
+void random16_add_entropy(uint16_t entropy);
+
+struct CHSV {
+    union {
+        struct {
+            uint8_t h;
+            uint8_t s;
+            uint8_t v;
+        };
+        uint8_t raw[3];
+    };
+    CHSV() : h(0), s(0), v(0) {}
+    CHSV(uint8_t ih, uint8_t is, uint8_t iv) : h(ih), s(is), v(iv) {}
+};
+
+struct CRGB;
+void hsv2rgb_rainbow(const CHSV& hsv, CRGB& rgb);
+
+struct CRGB {
+    union {
+        struct {
+            union { uint8_t r; uint8_t red; };
+            union { uint8_t g; uint8_t green; };
+            union { uint8_t b; uint8_t blue; };
+        };
+        uint8_t raw[3];
+    };
+
+    typedef enum {
+        AliceBlue = 0xF0F8FF, Aqua = 0x00FFFF, Aquamarine = 0x7FFFD4, Black = 0x000000,
+        Blue = 0x0000FF, Brown = 0xA52A2A, CadetBlue = 0x5F9EA0, Chocolate = 0xD2691E,
+        Coral = 0xFF7F50, CornflowerBlue = 0x6495ED, Crimson = 0xDC143C, Cyan = 0x00FFFF,
+        DarkBlue = 0x00008B, DarkCyan = 0x008B8B, DarkGoldenrod = 0xB8860B, DarkGray = 0xA9A9A9,
+        DarkGreen = 0x006400, DarkOliveGreen = 0x556B2F, DarkOrange = 0xFF8C00, DarkRed = 0x8B0000,
+        DarkSeaGreen = 0x8FBC8F, DarkSlateBlue = 0x483D8B, DarkSlateGray = 0x2F4F4F,
+        DarkTurquoise = 0x00CED1, DarkViolet = 0x9400D3, DeepPink = 0xFF1493, DeepSkyBlue = 0x00BFFF,
+        DodgerBlue = 0x1E90FF, FireBrick = 0xB22222, ForestGreen = 0x228B22, Fuchsia = 0xFF00FF,
+        Gold = 0xFFD700, Goldenrod = 0xDAA520, Gray = 0x808080, Green = 0x008000,
+        GreenYellow = 0xADFF2F, Honeydew = 0xF0FFF0, HotPink = 0xFF69B4, IndianRed = 0xCD5C5C,
+        Indigo = 0x4B0082, LawnGreen = 0x7CFC00, Lavender = 0xE6E6FA, LemonChiffon = 0xFFFACD,
+        LightBlue = 0xADD8E6, LightCyan = 0xE0FFFF, LightGreen = 0x90EE90, LightPink = 0xFFB6C1,
+        LightSkyBlue = 0x87CEFA, LightSteelBlue = 0xB0C4DE, LightYellow = 0xFFFFE0, Lime = 0x00FF00,
+        LimeGreen = 0x32CD32, Magenta = 0xFF00FF, Maroon = 0x800000, MediumAquamarine = 0x66CDAA,
+        MediumBlue = 0x0000CD, MediumOrchid = 0xBA55D3, MediumSpringGreen = 0x00FA9A,
+        MidnightBlue = 0x191970, Navy = 0x000080, OliveDrab = 0x6B8E23, Orange = 0xFFA500,
+        OrangeRed = 0xFF4500, PaleGreen = 0x98FB98, PaleTurquoise = 0xAFEEEE, Peru = 0xCD853F,
+        Pink = 0xFFC0CB, PowderBlue = 0xB0E0E6, Purple = 0x800080, Red = 0xFF0000,
+        RoyalBlue = 0x4169E1, SaddleBrown = 0x8B4513, SeaGreen = 0x2E8B57, Sienna = 0xA0522D,
+        Silver = 0xC0C0C0, SkyBlue = 0x87CEEB, SpringGreen = 0x00FF7F, SteelBlue = 0x4682B4,
+        Teal = 0x008080, Thistle = 0xD8BFD8, Tomato = 0xFF6347, Turquoise = 0x40E0D0,
+        Violet = 0xEE82EE, White = 0xFFFFFF, Yellow = 0xFFFF00, YellowGreen = 0x9ACD32
+    } HTMLColorCode;
+
+    CRGB() : r(0), g(0), b(0) {}
+    CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) {}
+    CRGB(uint32_t colorcode) : r((colorcode >> 16) & 0xFF), g((colorcode >> 8) & 0xFF), b(colorcode & 0xFF) {}
+    CRGB(HTMLColorCode colorcode) : CRGB((uint32_t)colorcode) {}
+    CRGB(const CHSV& hsv) { hsv2rgb_rainbow(hsv, *this); }
+
+    uint8_t& operator[](uint8_t x) { return raw[x]; }
+    const uint8_t& operator[](uint8_t x) const { return raw[x]; }
+    CRGB& nscale8(uint8_t scaledown);
+    CRGB& nscale8_video(uint8_t scaledown);
+};
+
+inline bool operator==(const CRGB& a, const CRGB& b) {
+    return a.r == b.r && a.g == b.g && a.b == b.b;
+}
+
+inline bool operator!=(const CRGB& a, const CRGB& b) {
+    return !(a == b);
+}
+
+typedef uint32_t TProgmemRGBPalette16[16];
+
+class CRGBPalette16 {
+public:
+    CRGB entries[16];
+
+    CRGBPalette16() {}
+    CRGBPalette16(const CRGB& c00, const CRGB& c01, const CRGB& c02, const CRGB& c03,
+                  const CRGB& c04, const CRGB& c05, const CRGB& c06, const CRGB& c07,
+                  const CRGB& c08, const CRGB& c09, const CRGB& c10, const CRGB& c11,
+                  const CRGB& c12, const CRGB& c13, const CRGB& c14, const CRGB& c15);
+    CRGBPalette16(const TProgmemRGBPalette16& rhs);
+    CRGBPalette16(const CHSV& c1, const CHSV& c2, const CHSV& c3, const CHSV& c4);
+    CRGBPalette16& operator=(const TProgmemRGBPalette16& rhs);
+
+    bool operator==(const CRGBPalette16& rhs) const;
+    bool operator!=(const CRGBPalette16& rhs) const { return !(*this == rhs); }
+
+    CRGB& operator[](uint8_t x) { return entries[x]; }
+    const CRGB& operator[](uint8_t x) const { return entries[x]; }
+    operator CRGB*() { return entries; }
+    operator const CRGB*() const { return entries; }
+};
+
+extern const TProgmemRGBPalette16 CloudColors_p;
+extern const TProgmemRGBPalette16 LavaColors_p;
+extern const TProgmemRGBPalette16 OceanColors_p;
+extern const TProgmemRGBPalette16 ForestColors_p;
+extern const TProgmemRGBPalette16 RainbowColors_p;
+extern const TProgmemRGBPalette16 PartyColors_p;
+extern const TProgmemRGBPalette16 HeatColors_p;
+
+typedef enum { NOBLEND = 0, LINEARBLEND = 1 } TBlendType;
+
+CRGB ColorFromPalette(const CRGBPalette16& pal, uint8_t index, uint8_t brightness = 255,
+                      TBlendType blendType = LINEARBLEND);
+void nblendPaletteTowardPalette(CRGBPalette16& current, CRGBPalette16& target, uint8_t maxChanges);
+CRGB blend(const CRGB& p1, const CRGB& p2, fract8 amountOfP2);
+CRGB* blend(const CRGB* src1, const CRGB* src2, CRGB* dest, uint16_t count, fract8 amountOfsrc2);
+void fill_solid(CRGB* leds, int numToFill, const CRGB& color);
+
+enum EOrder { RGB = 0012, RBG = 0021, GRB = 0102, GBR = 0120, BRG = 0201, BGR = 0210 };
+
+// Clockless chipsets, as declared by FastLED (the controller behind them is not needed here)
+template<uint8_t DATA_PIN, EOrder RGB_ORDER = GRB> class WS2812B {};
+template<uint8_t DATA_PIN, EOrder RGB_ORDER = GRB> class WS2812 {};
+template<uint8_t DATA_PIN, EOrder RGB_ORDER = GRB> class WS2811 {};
+template<uint8_t DATA_PIN, EOrder RGB_ORDER = GRB> class SK6812 {};
+
+class CLEDController {
+private:
+    CRGB* data;
+    int count;
+
+public:
+    CLEDController() : data(nullptr), count(0) {}
+    virtual ~CLEDController() {}
+
+    CLEDController& setLeds(CRGB* leds, int nLeds) { data = leds; count = nLeds; return *this; }
+    CRGB* leds() { return data; }
+    int size() { return count; }
+};
+
+// Receives each controller's pixels and the scale they are sent with on every show()
+typedef void (*LumiHostShowFn)(CLEDController& controller, uint8_t scale);
+
+#define LUMI_HOST_MAX_CONTROLLERS 8
+
+class CFastLED {
+private:
+    CLEDController controllers[LUMI_HOST_MAX_CONTROLLERS];
+    int controllerCount;
+    uint8_t brightness;
+    uint8_t maxVolts;
+    uint32_t maxMilliamps;
+    std::atomic<uint32_t> shows;   // show() may run on the library's show thread
+    LumiHostShowFn showHook;
+
+    CLEDController& addController(CRGB* data, int nLeds);
+
+public:
+    CFastLED();
+
+    template<template<uint8_t DATA_PIN, EOrder RGB_ORDER> class CHIPSET, uint8_t DATA_PIN, EOrder RGB_ORDER>
+    CLEDController& addLeds(CRGB* data, int nLedsOrOffset, int nLedsIfOffset = 0) {
+        return addController(data + (nLedsIfOffset ? nLedsOrOffset : 0),
+                             nLedsIfOffset ? nLedsIfOffset : nLedsOrOffset);
+    }
+
+    template<template<uint8_t DATA_PIN> class CHIPSET, uint8_t DATA_PIN>
+    CLEDController& addLeds(CRGB* data, int nLedsOrOffset, int nLedsIfOffset = 0) {
+        return addController(data + (nLedsIfOffset ? nLedsOrOffset : 0),
+                             nLedsIfOffset ? nLedsIfOffset : nLedsOrOffset);
+    }
+
+    void setBrightness(uint8_t scale) { brightness = scale; }
+    uint8_t getBrightness() { return brightness; }
+    void setMaxPowerInVoltsAndMilliamps(uint8_t volts, uint32_t milliamps);
+    void setDither(uint8_t) {}
+
+    void show() { show(brightness); }
+    void show(uint8_t scale);
+    void clear(bool writeData = false);
+    int count() { return controllerCount; }
+    CLEDController& operator[](int x) { return controllers[x]; }
+
+    // Host only
+    void setShowHook(LumiHostShowFn fn) { showHook = fn; }
+    uint32_t getShowCount() { return shows; }
+    void reset();
+};
+
+#define BINARY_DITHER 0x01
+#define DISABLE_DITHER 0x00
+
+extern CFastLED FastLED;
+
+#endif // LUMI_HOST_FASTLED_H
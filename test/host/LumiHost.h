@@ -0,0 +1,101 @@
+/*
+ * AvantLumi Library - Host Test Controls
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * Test-side access to the host shims: the simulated clock behind millis() and
+ * micros(), pin states, and an in-process UDP network. Not part of the
+ * library; only tests include this.
+ */
+
+#ifndef LUMI_HOST_H
+#define LUMI_HOST_H
+
+#include "Arduino.h"
+#include "Udp.h"
+#include <deque>
+#include <vector>
+
+// Simulated clock. Starts at 0 and moves only when advanced (delay() advances it too).
+void lumiHostSetMicros(uint64_t us);
+uint64_t lumiHostMicros();
+void lumiHostAdvanceMs(uint32_t ms);
+void lumiHostAdvanceUs(uint32_t us);
+
+// Last value written to a pin with digitalWrite(), -1 if never written
+int lumiHostPin(uint8_t pin);
+
+class LoopbackUdp;
+
+// Delivers packets between LoopbackUdp sockets on simulated time
+class LoopbackNetwork {
+private:
+    std::vector<LoopbackUdp*> sockets;
+    uint32_t latencyUs;
+    uint32_t sent;
+
+    friend class LoopbackUdp;
+    void attach(LoopbackUdp* socket);
+    void detach(LoopbackUdp* socket);
+    void deliver(LoopbackUdp* from, IPAddress to, uint16_t port, const std::vector<uint8_t>& data);
+
+public:
+    LoopbackNetwork();
+
+    void setLatencyUs(uint32_t us) { latencyUs = us; }
+    uint32_t getPacketsSent() { return sent; }
+};
+
+class LoopbackUdp : public UDP {
+private:
+    struct Packet {
+        std::vector<uint8_t> data;
+        IPAddress from;
+        uint16_t fromPort;
+        uint64_t deliverAt;
+    };
+
+    LoopbackNetwork& network;
+    IPAddress address;
+    uint16_t localPort;
+    bool bound;
+    std::deque<Packet> queue;
+    Packet current;
+    size_t cursor;
+    std::vector<uint8_t> outgoing;
+    IPAddress outgoingTo;
+    uint16_t outgoingPort;
+
+    friend class LoopbackNetwork;
+
+public:
+    LoopbackUdp(LoopbackNetwork& net, IPAddress ip);
+    ~LoopbackUdp();
+
+    IPAddress localIP() { return address; }
+    uint16_t boundPort() { return bound ? localPort : 0; }
+    size_t pending() { return queue.size(); }
+
+    uint8_t begin(uint16_t port) override;
+    void stop() override;
+
+    int beginPacket(IPAddress ip, uint16_t port) override;
+    int beginPacket(const char* host, uint16_t port) override;
+    int endPacket() override;
+    size_t write(uint8_t value) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+
+    int parsePacket() override;
+    int available() override;
+    int read() override;
+    int read(unsigned char* buffer, size_t len) override;
+    int read(char* buffer, size_t len) override;
+    int peek() override;
+    void flush() override;
+
+    IPAddress remoteIP() override;
+    uint16_t remotePort() override;
+};
+
+#endif // LUMI_HOST_H
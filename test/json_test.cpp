@@ -0,0 +1,186 @@
+/*
+ * AvantLumi Library - JSON Command Tests
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * LumiJsonReader must tokenize flat objects in place and report where a
+ * malformed one goes wrong. applyCommand() must reject malformed or run-on
+ * input before changing anything, stop at an unknown key or a bad value,
+ * and report the offset, the key and how many fields it applied.
+ */
+
+#include <AvantLumi.h>
+#include <LumiHost.h>
+#include "lumi_test.h"
+
+#define TEST_LEDS 30
+
+static bool tokenIs(const LumiJsonToken& token, const char* text) {
+    return LumiJsonReader::equals(token, text);
+}
+
+static void testReader() {
+    const char* json = " { \"bright\" : 3, \"palette\":\"ocean\",\"rgb\":[255, 0,7],"
+                       "\"fade\":true,\"x\":null,\"nested\":{\"a\":[1,{\"b\":\"}\"}]} } ";
+    LumiJsonReader reader(json, strlen(json));
+    LumiJsonToken key, value;
+    int32_t number;
+    bool flag;
+    int32_t items[3];
+
+    LUMI_CHECK(reader.begin());
+    LUMI_CHECK_EQ(reader.next(key, value), 1);
+    LUMI_CHECK(tokenIs(key, "bright"));
+    LUMI_CHECK_EQ(value.type, LUMI_JSON_NUMBER);
+    LUMI_CHECK(LumiJsonReader::toInt(value, number) && number == 3);
+
+    LUMI_CHECK_EQ(reader.next(key, value), 1);
+    LUMI_CHECK(tokenIs(key, "palette"));
+    LUMI_CHECK_EQ(value.type, LUMI_JSON_STRING);
+    LUMI_CHECK(tokenIs(value, "ocean"));
+    LUMI_CHECK(!LumiJsonReader::toInt(value, number));
+
+    LUMI_CHECK_EQ(reader.next(key, value), 1);
+    LUMI_CHECK_EQ(value.type, LUMI_JSON_ARRAY);
+    LUMI_CHECK_EQ(LumiJsonReader::toInts(value, items, 3), 3);
+    LUMI_CHECK(items[0] == 255 && items[1] == 0 && items[2] == 7);
+    LUMI_CHECK_EQ(LumiJsonReader::toInts(value, items, 2), -1);
+
+    LUMI_CHECK_EQ(reader.next(key, value), 1);
+    LUMI_CHECK(LumiJsonReader::toBool(value, flag) && flag);
+
+    LUMI_CHECK_EQ(reader.next(key, value), 1);
+    LUMI_CHECK_EQ(value.type, LUMI_JSON_NULL);
+
+    // Nested values are skipped whole, including brackets inside strings
+    LUMI_CHECK_EQ(reader.next(key, value), 1);
+    LUMI_CHECK_EQ(value.type, LUMI_JSON_OBJECT);
+    LUMI_CHECK_EQ(value.length, (uint16_t)strlen("{\"a\":[1,{\"b\":\"}\"}]}"));
+
+    LUMI_CHECK_EQ(reader.next(key, value), 0);
+    LUMI_CHECK(reader.finish());
+
+    // Numbers: a zero fraction is an integer, anything else is not
+    const char* numbers = "{\"a\":-12,\"b\":4.0,\"c\":4.5,\"d\":1e3,\"e\":999999999999}";
+    LumiJsonReader numberReader(numbers, strlen(numbers));
+    LUMI_CHECK(numberReader.begin());
+    static const bool valid[] = { true, true, false, false, false };
+    for (bool expected : valid) {
+        LUMI_CHECK_EQ(numberReader.next(key, value), 1);
+        LUMI_CHECK_EQ(LumiJsonReader::toInt(value, number), expected);
+    }
+    LUMI_CHECK_EQ(number, 4);
+}
+
+// Offset at which the reader reports a syntax error, or -1 if it reads the whole object
+static int syntaxErrorAt(const char* json) {
+    LumiJsonReader reader(json, strlen(json));
+    if (!reader.begin()) {
+        return reader.offset();
+    }
+    LumiJsonToken key, value;
+    int8_t status;
+    while ((status = reader.next(key, value)) > 0) {
+    }
+    return status < 0 ? reader.offset() : -1;
+}
+
+static void testReaderErrors() {
+    LUMI_CHECK_EQ(syntaxErrorAt("{}"), -1);
+    LUMI_CHECK_EQ(syntaxErrorAt("  [1]"), 2);                  // Not an object
+    LUMI_CHECK_EQ(syntaxErrorAt("{\"a\":1 \"b\":2}"), 7);      // Missing comma
+    LUMI_CHECK_EQ(syntaxErrorAt("{\"a\" 1}"), 5);              // Missing colon
+    LUMI_CHECK_EQ(syntaxErrorAt("{\"a\":1,}"), 7);             // Trailing comma
+    LUMI_CHECK_EQ(syntaxErrorAt("{\"a\":yes}"), 8);            // Unknown literal
+    LUMI_CHECK_EQ(syntaxErrorAt("{\"a\":\"open}"), 11);        // Unterminated string
+    LUMI_CHECK_EQ(syntaxErrorAt("{\"a\":[1,2}"), 9);           // Mismatched bracket
+    LUMI_CHECK_EQ(syntaxErrorAt("{\"a\":[[[[[1]]]]]}"), 9);    // Nested past LUMI_JSON_MAX_DEPTH
+    LUMI_CHECK_EQ(syntaxErrorAt("{\"bright\":3"), 11);         // Truncated
+}
+
+static void testApplyErrors() {
+    FastLED.reset();
+    AvantLumi lumi(5, TEST_LEDS);
+    LUMI_CHECK(lumi.begin());
+    LUMI_CHECK(lumi.setBright(1));
+    LUMI_CHECK(lumi.setPalette("lava"));
+    lumi.setSwitch(true);
+    lumi.setFade(false);
+    lumi.update();
+
+    // Both switch and fade are decoded by key, not by first letter
+    const char* flags = "{\"switch\":\"off\",\"fade\":true}";
+    LumiCommandResult result = lumi.applyCommand(flags, strlen(flags));
+    LUMI_CHECK_EQ(result.error, LUMI_CMD_OK);
+    LUMI_CHECK_EQ(result.applied, 2);
+    lumi.update();
+    LUMI_CHECK(!lumi.getSwitch());
+    LUMI_CHECK(lumi.getFade());
+
+    // Truncated: rejected at the end of the input with nothing applied
+    const char* truncated = "{\"bright\":4,\"palette\":\"oce";
+    result = lumi.applyCommand(truncated, strlen(truncated));
+    LUMI_CHECK_EQ(result.error, LUMI_CMD_SYNTAX);
+    LUMI_CHECK_EQ(result.offset, strlen(truncated));
+    LUMI_CHECK_EQ(result.applied, 0);
+
+    // Bytes after the closing brace: rejected at the first of them
+    const char* runOn = "{\"bright\":4} {\"bright\":5}";
+    result = lumi.applyCommand(runOn, strlen(runOn));
+    LUMI_CHECK_EQ(result.error, LUMI_CMD_SYNTAX);
+    LUMI_CHECK_EQ(result.offset, 13);
+    const char* trailingSpace = "{\"bright\":4}\r\n";
+    LUMI_CHECK_EQ(lumi.applyCommand(trailingSpace, strlen(trailingSpace)).error, LUMI_CMD_OK);
+    lumi.update();
+    LUMI_CHECK_EQ(lumi.getBright(), 4);
+
+    // Unknown key after one good field: the first is applied, the offset is at the key
+    const char* unknown = "{\"bright\":2,\"sparkle\":1,\"palette\":\"ocean\"}";
+    result = lumi.applyCommand(unknown, strlen(unknown));
+    LUMI_CHECK_EQ(result.error, LUMI_CMD_UNKNOWN_FIELD);
+    LUMI_CHECK_EQ(result.applied, 1);
+    LUMI_CHECK_EQ(result.offset, 13);
+    LUMI_CHECK_EQ(result.fieldLength, 7);
+    LUMI_CHECK(strncmp(result.field, "sparkle", result.fieldLength) == 0);
+    lumi.update();
+    LUMI_CHECK_EQ(lumi.getBright(), 2);
+    LUMI_CHECK(lumi.getPalette() == "lava");
+
+    // Bad values: wrong type, out of range, unknown name. The offset is at the
+    // value, past the opening quote for strings
+    static const struct {
+        const char* json;
+        uint8_t applied;
+        uint16_t offset;
+    } badValues[] = {
+        { "{\"bright\":\"high\"}", 0, 11 },
+        { "{\"fade\":1}", 0, 8 },
+        { "{\"palette\":\"ocean\",\"rgb\":[255,0]}", 1, 25 },
+        { "{\"switch\":true,\"fade\":false,\"rgb\":[1,2,300]}", 2, 34 },
+        { "{\"color\":\"mauvish\"}", 0, 10 },
+        { "{\"bright\":3,\"preset\":7}", 1, 21 },
+        { "{\"config\":\"wipe\"}", 0, 11 },
+    };
+    for (const auto& bad : badValues) {
+        result = lumi.applyCommand(bad.json, strlen(bad.json));
+        LUMI_CHECK_EQ(result.error, LUMI_CMD_BAD_VALUE);
+        LUMI_CHECK_EQ(result.applied, bad.applied);
+        LUMI_CHECK_EQ(result.offset, bad.offset);
+        lumi.update();
+    }
+    // The fields before each bad value took effect
+    LUMI_CHECK(lumi.getSwitch());
+    LUMI_CHECK(!lumi.getFade());
+    LUMI_CHECK_EQ(lumi.getBright(), 3);
+    LUMI_CHECK(lumi.getPalette() == "ocean");
+    LUMI_CHECK(strcmp(AvantLumi::commandErrorText(LUMI_CMD_BAD_VALUE), "invalid value") == 0);
+}
+
+int main() {
+    EEPROM.erase();
+    testReader();
+    testReaderErrors();
+    testApplyErrors();
+    return lumiTestResult("json");
+}
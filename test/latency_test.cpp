@@ -0,0 +1,197 @@
+/*
+ * AvantLumi Library - Command Burst Replay Test
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * Bursts of commands arrive at pseudo-random points between frames, through
+ * setters and JSON, while the sketch calls update() every 16 ms on the
+ * simulated clock. A reference model works out when each change first
+ * reaches a shown frame; getLatencyStats() and the "lat" status figures
+ * must match it exactly, with commands applied at once and coalesced.
+ */
+
+#include <AvantLumi.h>
+#include <LumiHost.h>
+#include "lumi_test.h"
+
+#define TEST_LEDS 60
+#define FRAME_MS 16
+#define BURSTS 200
+
+static uint32_t shows = 0;
+
+static void onShow(CLEDController& controller, uint8_t scale) {
+    shows++;
+}
+
+// Every command changes the state, so each one counts as ingress
+static void sendCommand(AvantLumi& lumi, uint32_t k) {
+    static const char* const palettes[] = { "ocean", "forest", "lava", "party" };
+    char json[32];
+    switch (k % 3) {
+        case 0:
+            lumi.setBright(1 + k % 5);
+            break;
+        case 1:
+            snprintf(json, sizeof(json), "{\"bright\":%lu}", (unsigned long)(1 + k % 5));
+            LUMI_CHECK_EQ(lumi.applyCommand(json, strlen(json)).error, LUMI_CMD_OK);
+            break;
+        default:
+            lumi.setPalette(palettes[k % 4]);
+            break;
+    }
+}
+
+static void addExpected(LumiLatencyStats& stats, uint64_t& sum, uint32_t elapsedUs) {
+    uint32_t ms = elapsedUs / 1000;
+    uint8_t bucket = 0;
+    while (ms > 0 && bucket < LUMI_LATENCY_BUCKETS - 1) {
+        ms >>= 1;
+        bucket++;
+    }
+    stats.buckets[bucket]++;
+    if (stats.count == 0 || elapsedUs < stats.minUs) {
+        stats.minUs = elapsedUs;
+    }
+    stats.maxUs = max(stats.maxUs, elapsedUs);
+    stats.count++;
+    sum += elapsedUs;
+    stats.meanUs = (uint32_t)(sum / stats.count);
+}
+
+// Replays the same bursts every time: 1-8 commands, 0.5-3 ms apart, starting
+// anywhere in the frame and sometimes running across one or more frames.
+// The oldest change not yet shown is measured to the next frame.
+static LumiLatencyStats replay(AvantLumi& lumi, LumiLatencyStats& expected) {
+    memset(&expected, 0, sizeof(expected));
+    uint64_t expectedSum = 0;
+    uint32_t rng = 2463534242u;
+    uint32_t command = 0;
+    uint64_t nextFrame = lumiHostMicros() + FRAME_MS * 1000;
+    uint64_t pendingSince = 0;
+
+    for (int burst = 0; burst < BURSTS; burst++) {
+        rng ^= rng << 13;
+        rng ^= rng >> 17;
+        rng ^= rng << 5;
+        uint64_t at = nextFrame + rng % (FRAME_MS * 1000);
+        uint8_t size = 1 + (rng >> 16) % 8;
+        uint32_t gap = 500 + (rng >> 8) % 2500;
+
+        for (uint8_t c = 0; c < size; c++, at += gap) {
+            // Frames due before this command
+            while (nextFrame <= at) {
+                lumiHostSetMicros(nextFrame);
+                uint32_t before = shows;
+                lumi.update();
+                LUMI_CHECK_EQ(shows, before + 1);
+                if (pendingSince != 0) {
+                    addExpected(expected, expectedSum, nextFrame - pendingSince);
+                    pendingSince = 0;
+                }
+                nextFrame += FRAME_MS * 1000;
+            }
+            lumiHostSetMicros(at);
+            sendCommand(lumi, command++);
+            if (pendingSince == 0) {
+                pendingSince = at;
+            }
+        }
+    }
+    lumiHostSetMicros(nextFrame);
+    lumi.update();
+    if (pendingSince != 0) {
+        addExpected(expected, expectedSum, nextFrame - pendingSince);
+    }
+    return lumi.getLatencyStats();
+}
+
+static void checkStats(const LumiLatencyStats& actual, const LumiLatencyStats& expected) {
+    LUMI_CHECK_EQ(actual.count, expected.count);
+    LUMI_CHECK_EQ(actual.minUs, expected.minUs);
+    LUMI_CHECK_EQ(actual.meanUs, expected.meanUs);
+    LUMI_CHECK_EQ(actual.maxUs, expected.maxUs);
+    for (uint8_t i = 0; i < LUMI_LATENCY_BUCKETS; i++) {
+        LUMI_CHECK_EQ(actual.buckets[i], expected.buckets[i]);
+    }
+}
+
+static void testBurstReplay(bool coalescing) {
+    FastLED.reset();
+    FastLED.setShowHook(onShow);
+    lumiHostSetMicros(1000000);
+    AvantLumi lumi(5, TEST_LEDS);
+    LUMI_CHECK(lumi.begin());
+    lumi.setPalette("ocean");
+    lumi.setFade(true);
+    lumi.setCoalescing(coalescing);
+    lumi.update();
+    lumi.resetLatencyStats();
+
+    LumiLatencyStats expected;
+    LumiLatencyStats actual = replay(lumi, expected);
+    checkStats(actual, expected);
+
+    // Every burst is measured at least once; a frame never lags more than a frame period
+    LUMI_CHECK(expected.count >= BURSTS);
+    LUMI_CHECK(actual.maxUs <= FRAME_MS * 1000);
+    LUMI_CHECK(actual.minUs > 0);
+    printf("%s: %lu frames measured, min %lu us, mean %lu us, max %lu us\n",
+           coalescing ? "coalesced" : "direct", (unsigned long)actual.count,
+           (unsigned long)actual.minUs, (unsigned long)actual.meanUs, (unsigned long)actual.maxUs);
+
+    // The same figures are published in the status text
+    char lat[160];
+    snprintf(lat, sizeof(lat), "\"lat\":{\"n\":%lu,\"min_us\":%lu,\"mean_us\":%lu,\"max_us\":%lu,\"hist\":[",
+             (unsigned long)expected.count, (unsigned long)expected.minUs,
+             (unsigned long)expected.meanUs, (unsigned long)expected.maxUs);
+    LUMI_CHECK(strstr(lumi.getStatusText(), lat) != nullptr);
+
+    lumi.resetLatencyStats();
+    LUMI_CHECK_EQ(lumi.getLatencyStats().count, 0);
+    FastLED.setShowHook(nullptr);
+}
+
+// Changes made by update() itself are not commands and start no measurement
+static void testIdleStripWakes() {
+    FastLED.reset();
+    FastLED.setShowHook(onShow);
+    lumiHostSetMicros(1000000);
+    AvantLumi lumi(5, TEST_LEDS);
+    LUMI_CHECK(lumi.begin());
+    lumi.setFade(false);
+    lumi.setRGB(10, 20, 30);
+    for (int i = 0; i < 1000 && !lumi.isIdle(); i++) {
+        lumi.update();
+        lumiHostAdvanceMs(FRAME_MS);
+    }
+    LUMI_CHECK(lumi.isIdle());
+    lumi.resetLatencyStats();
+    uint32_t before = shows;
+    for (int i = 0; i < 20; i++) {
+        lumi.update();
+        lumiHostAdvanceMs(FRAME_MS);
+    }
+    LUMI_CHECK_EQ(shows, before);
+    LUMI_CHECK_EQ(lumi.getLatencyStats().count, 0);
+
+    // A command to a settled, idle strip is shown by the next update()
+    lumiHostAdvanceUs(3500);
+    lumi.setRGB(200, 40, 0);
+    lumiHostAdvanceUs(FRAME_MS * 1000 - 3500);
+    lumi.update();
+    LUMI_CHECK_EQ(shows, before + 1);
+    LumiLatencyStats stats = lumi.getLatencyStats();
+    LUMI_CHECK_EQ(stats.count, 1);
+    LUMI_CHECK_EQ(stats.minUs, FRAME_MS * 1000 - 3500);
+    LUMI_CHECK_EQ(stats.buckets[4], 1);   // 12.5 ms is in <16
+    FastLED.setShowHook(nullptr);
+}
+
+int main() {
+    testBurstReplay(false);
+    testBurstReplay(true);
+    testIdleStripWakes();
+    return lumiTestResult("latency");
+}
@@ -0,0 +1,32 @@
+/*
+ * AvantLumi Library - Host Benchmark Helpers
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * Benchmarks run the library on the simulated clock but time it with the
+ * PC's wall clock. Pass --quick for a short smoke run (ctest does); figures
+ * from a quick run are not meaningful.
+ */
+
+#ifndef LUMI_BENCH_H
+#define LUMI_BENCH_H
+
+#include <chrono>
+#include <string.h>
+
+static inline uint64_t lumiBenchNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static inline bool lumiBenchQuick(int argc, char** argv) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--quick") == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+#endif // LUMI_BENCH_H
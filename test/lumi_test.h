@@ -0,0 +1,44 @@
+/*
+ * AvantLumi Library - Host Test Helpers
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * Minimal check macros shared by the host tests. A failed check prints its
+ * location and the test keeps going; lumiTestResult() is the exit code.
+ */
+
+#ifndef LUMI_TEST_H
+#define LUMI_TEST_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+static int lumiTestFailures = 0;
+static int lumiTestChecks = 0;
+
+#define LUMI_CHECK(cond) do { \
+        lumiTestChecks++; \
+        if (!(cond)) { \
+            lumiTestFailures++; \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+        } \
+    } while (0)
+
+#define LUMI_CHECK_EQ(actual, expected) do { \
+        lumiTestChecks++; \
+        long long lumiActual = (long long)(actual); \
+        long long lumiExpected = (long long)(expected); \
+        if (lumiActual != lumiExpected) { \
+            lumiTestFailures++; \
+            fprintf(stderr, "%s:%d: %s is %lld, expected %lld\n", __FILE__, __LINE__, \
+                    #actual, lumiActual, lumiExpected); \
+        } \
+    } while (0)
+
+static inline int lumiTestResult(const char* name) {
+    printf("%s: %d checks, %d failed\n", name, lumiTestChecks, lumiTestFailures);
+    return lumiTestFailures ? 1 : 0;
+}
+
+#endif // LUMI_TEST_H
@@ -0,0 +1,304 @@
+/*
+ * AvantLumi Library - Allocation Accounting Test
+ *
+ * Linked with -Wl,--wrap=malloc,--wrap=free,--wrap=calloc,--wrap=realloc and
+ * a replaced operator new, so every heap block taken by the library passes
+ * through the counters below. Each feature that owns memory is switched on
+ * and off again; getMemoryStats() must count the same allocations and report
+ * the same bytes as the allocator saw. Then a long run of frames, setters,
+ * commands and status reads must not touch the allocator at all.
+ */
+
+#include <AvantLumi.h>
+#include <LumiAudio.h>
+#include <LumiHost.h>
+#include <new>
+#include <vector>
+#include "lumi_test.h"
+
+extern "C" {
+void* __real_malloc(size_t size);
+void __real_free(void* ptr);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+}
+
+// Blocks taken while tracking, kept in a fixed table so the bookkeeping
+// itself never allocates
+#define TRACK_MAX 256
+
+static bool tracking = false;
+static uint32_t trackedAllocs = 0;
+static void* trackedBlock[TRACK_MAX];
+static size_t trackedSize[TRACK_MAX];
+
+static void track(void* ptr, size_t size) {
+    if (!tracking || ptr == nullptr) {
+        return;
+    }
+    trackedAllocs++;
+    for (int i = 0; i < TRACK_MAX; i++) {
+        if (trackedBlock[i] == nullptr) {
+            trackedBlock[i] = ptr;
+            trackedSize[i] = size;
+            return;
+        }
+    }
+    abort();
+}
+
+static void untrack(void* ptr) {
+    for (int i = 0; ptr != nullptr && i < TRACK_MAX; i++) {
+        if (trackedBlock[i] == ptr) {
+            trackedBlock[i] = nullptr;
+            return;
+        }
+    }
+}
+
+static size_t trackedBytes() {
+    size_t total = 0;
+    for (int i = 0; i < TRACK_MAX; i++) {
+        if (trackedBlock[i] != nullptr) {
+            total += trackedSize[i];
+        }
+    }
+    return total;
+}
+
+extern "C" {
+void* __wrap_malloc(size_t size) {
+    void* ptr = __real_malloc(size);
+    track(ptr, size);
+    return ptr;
+}
+
+void __wrap_free(void* ptr) {
+    untrack(ptr);
+    __real_free(ptr);
+}
+
+void* __wrap_calloc(size_t count, size_t size) {
+    void* ptr = __real_calloc(count, size);
+    track(ptr, count * size);
+    return ptr;
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+    untrack(ptr);
+    void* moved = __real_realloc(ptr, size);
+    track(moved, size);
+    return moved;
+}
+}
+
+void* operator new(size_t size) {
+    void* ptr = __wrap_malloc(size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return __wrap_malloc(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    __wrap_free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    __wrap_free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    __wrap_free(ptr);
+}
+
+#define TEST_LEDS 64
+
+static uint32_t instBase;
+static uint32_t allocsBase;
+
+// Library figures must move exactly as the allocator saw them move
+static void checkAccounting(AvantLumi& lumi, const char* step) {
+    LumiMemoryStats mem = lumi.getMemoryStats();
+    long long inst = (long long)mem.instanceBytes - instBase;
+    long long allocs = (long long)mem.allocations - allocsBase;
+    if (inst != (long long)trackedBytes() || allocs != trackedAllocs) {
+        fprintf(stderr, "%s: inst +%lld allocs +%lld, allocator saw %zu bytes in %u blocks\n",
+                step, inst, allocs, trackedBytes(), trackedAllocs);
+    }
+    LUMI_CHECK_EQ(inst, trackedBytes());
+    LUMI_CHECK_EQ(allocs, trackedAllocs);
+}
+
+static bool writeSilence(const char* path) {
+    FILE* f = fopen(path, "wb");
+    if (f == nullptr) {
+        return false;
+    }
+    static const uint8_t header[44] = {
+        'R', 'I', 'F', 'F', 36 + 64, 0, 0, 0, 'W', 'A', 'V', 'E', 'f', 'm', 't', ' ',
+        16, 0, 0, 0, 1, 0, 1, 0, 0x80, 0x3E, 0, 0, 0, 0x7D, 0, 0, 2, 0, 16, 0,
+        'd', 'a', 't', 'a', 64, 0, 0, 0
+    };
+    uint8_t data[64] = {};
+    bool ok = fwrite(header, 1, sizeof(header), f) == sizeof(header) && fwrite(data, 1, sizeof(data), f) == sizeof(data);
+    return fclose(f) == 0 && ok;
+}
+
+static void testOwnedBuffers() {
+    FastLED.reset();
+    AvantLumi lumi(5, TEST_LEDS);
+    LUMI_CHECK(lumi.begin());
+
+    // Only the frame buffer so far
+    LumiMemoryStats mem = lumi.getMemoryStats();
+    LUMI_CHECK_EQ(mem.instanceBytes, sizeof(AvantLumi) + TEST_LEDS * sizeof(CRGB));
+    instBase = mem.instanceBytes;
+    allocsBase = mem.allocations;
+
+    std::string wavPath = std::string(getenv("TMPDIR") ? getenv("TMPDIR") : "/tmp") + "/lumi_memory.wav";
+    LUMI_CHECK(writeSilence(wavPath.c_str()));
+    LumiWavSource wav;
+    LUMI_CHECK(wav.open(wavPath.c_str()));
+
+    tracking = true;
+    lumi.getStatusText();
+    checkAccounting(lumi, "status");
+    LUMI_CHECK(lumi.beginCues(8));
+    checkAccounting(lumi, "cues");
+    LUMI_CHECK(lumi.setDoubleBuffer(true));
+    checkAccounting(lumi, "double buffer");
+    LUMI_CHECK(lumi.setHighPrecision(true));
+    checkAccounting(lumi, "high precision");
+    LUMI_CHECK(lumi.setInterpolation(40));
+    checkAccounting(lumi, "interpolation");
+    LUMI_CHECK(lumi.setMatrix(8, 8));
+    checkAccounting(lumi, "matrix");
+    LUMI_CHECK(lumi.beginAudio(wav));
+    checkAccounting(lumi, "audio");
+    LUMI_CHECK(trackedAllocs >= 10);
+
+    // Switching features off returns their memory
+    lumi.endAudio();
+    checkAccounting(lumi, "end audio");
+    LUMI_CHECK(lumi.setInterpolation(0));
+    checkAccounting(lumi, "end interpolation");
+    LUMI_CHECK(lumi.setHighPrecision(false));
+    checkAccounting(lumi, "end high precision");
+    LUMI_CHECK(lumi.setDoubleBuffer(false));
+    checkAccounting(lumi, "end double buffer");
+    tracking = false;
+
+    remove(wavPath.c_str());
+    memset(trackedBlock, 0, sizeof(trackedBlock));
+    trackedAllocs = 0;
+}
+
+static void testSteadyStateChurn() {
+    FastLED.reset();
+    lumiHostSetMicros(0);
+    AvantLumi lumi(5, TEST_LEDS);
+    LUMI_CHECK(lumi.begin());
+    LUMI_CHECK(lumi.beginCues(4));
+    LUMI_CHECK(lumi.setDoubleBuffer(true));
+    LUMI_CHECK(lumi.setCrossfade(300));
+    lumi.getStatusText();
+    for (int i = 0; i < 100; i++) {
+        lumi.update();
+        lumiHostAdvanceMs(10);
+    }
+
+    // A controller in use for a few minutes: frames, named looks, commands,
+    // status polling and cue edits, all without the allocator
+    static const char* const palettes[] = { "ocean", "forest", "party", "lava", "random" };
+    static const char* const commands[] = {
+        "{\"bright\":2,\"palette\":\"ocean\"}",
+        "{\"rgb\":[10,200,30],\"fade\":\"off\"}",
+        "{\"switch\":\"on\",\"blend_spd\":3}"
+    };
+    uint32_t allocsBefore = lumi.getMemoryStats().allocations;
+    tracking = true;
+    for (int i = 0; i < 20000; i++) {
+        if (i % 50 == 0) {
+            lumi.setBright(1 + (i / 50) % 5);
+        }
+        if (i % 120 == 0) {
+            lumi.setPalette(palettes[(i / 120) % 5]);
+        }
+        if (i % 300 == 0) {
+            const char* command = commands[(i / 300) % 3];
+            lumi.applyCommand(command, strlen(command));
+        }
+        if (i % 700 == 0) {
+            int id = lumi.addCue(12, 0, 0, LUMI_CUE_EVERY_DAY, LUMI_CUE_BRIGHT, 3);
+            LUMI_CHECK(id >= 0);
+            LUMI_CHECK(lumi.removeCue(id));
+        }
+        if (i % 10 == 0) {
+            lumi.getStatusText();
+            lumi.getStatusJson();
+            lumi.getMemoryStats();
+        }
+        lumi.update();
+        lumiHostAdvanceMs(10);
+    }
+    tracking = false;
+    LUMI_CHECK_EQ(trackedAllocs, 0);
+    LUMI_CHECK_EQ(lumi.getMemoryStats().allocations, allocsBefore);
+}
+
+static void testHostHeapFigures() {
+    FastLED.reset();
+    AvantLumi lumi(5, TEST_LEDS);
+    LUMI_CHECK(lumi.begin());
+
+    // Off ESP32 the heap fields come from the C library rather than reading 0
+    LumiMemoryStats before = lumi.getMemoryStats();
+    LUMI_CHECK(before.freeHeap > 0);
+    LUMI_CHECK(before.minFreeHeap > 0 && before.minFreeHeap <= before.freeHeap);
+    std::vector<void*> blocks;
+    for (int i = 0; i < 64; i++) {
+        blocks.push_back(malloc(1024));
+    }
+    LumiMemoryStats full = lumi.getMemoryStats();
+    LUMI_CHECK(full.minFreeHeap <= full.freeHeap && full.minFreeHeap <= before.minFreeHeap);
+
+    // Every other block freed: the holes show up as free heap, the low-water mark stays
+    for (int i = 0; i < 64; i += 2) {
+        free(blocks[i]);
+    }
+    LumiMemoryStats after = lumi.getMemoryStats();
+    LUMI_CHECK(after.freeHeap >= full.freeHeap + 16 * 1024);
+    LUMI_CHECK_EQ(after.minFreeHeap, full.minFreeHeap);
+    for (int i = 1; i < 64; i += 2) {
+        free(blocks[i]);
+    }
+
+    // A library allocation lowers the mark even if it is freed before stats
+    // are read: two 90 KB frame buffers dip below the 64 KB of blocks above
+    LumiMemoryStats idle = lumi.getMemoryStats();
+    {
+        AvantLumi big(5, 30000);
+        LUMI_CHECK(big.begin());
+        LUMI_CHECK(big.setDoubleBuffer(true));
+        LUMI_CHECK(big.setDoubleBuffer(false));
+    }
+    LumiMemoryStats later = lumi.getMemoryStats();
+    LUMI_CHECK(later.minFreeHeap < idle.minFreeHeap);
+
+    // The mark is the process's, not the instance's
+    AvantLumi other(5, TEST_LEDS);
+    LUMI_CHECK(other.begin());
+    LUMI_CHECK_EQ(other.getMemoryStats().minFreeHeap, lumi.getMemoryStats().minFreeHeap);
+}
+
+int main() {
+    testOwnedBuffers();
+    testSteadyStateChurn();
+    testHostHeapFigures();
+    return lumiTestResult("memory_test");
+}
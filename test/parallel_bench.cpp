@@ -0,0 +1,74 @@
+/*
+ * AvantLumi Library - Parallel Render Scaling Benchmark
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * Times update() with parallel rendering off and on at strip lengths from
+ * 512 to 16000 LEDs and prints the speedup at each length. On a PC the
+ * worker is a std::thread, so the figures show the handoff cost against the
+ * work saved rather than ESP32 timings. Both modes must produce the same
+ * frame.
+ *
+ *   build/parallel_bench
+ */
+
+#include <AvantLumi.h>
+#include <LumiHost.h>
+#include <thread>
+#include "lumi_bench.h"
+#include "lumi_test.h"
+
+static uint32_t lastHash = 0;
+
+static void onFrame(const CRGB* frame, uint16_t count, uint8_t brightness) {
+    lastHash = AvantLumi::frameHash(frame, count, brightness);
+}
+
+// Wall-clock nanoseconds per update(); frameHash receives the hash of one more frame
+static double timeFrames(uint16_t numLeds, bool parallel, uint32_t frames, uint32_t& frameHash) {
+    FastLED.reset();
+    lumiHostSetMicros(0);
+    AvantLumi lumi(5, numLeds);
+    LUMI_CHECK(lumi.begin());
+    lumi.setPalette("ocean");
+    lumi.setFade(true);
+    LUMI_CHECK(lumi.setParallelRender(parallel));
+    for (int i = 0; i < 20; i++) {
+        lumi.update();
+        lumiHostAdvanceMs(10);
+    }
+
+    uint64_t elapsed = 0;
+    for (uint32_t i = 0; i < frames; i++) {
+        uint64_t start = lumiBenchNs();
+        lumi.update();
+        elapsed += lumiBenchNs() - start;
+        lumiHostAdvanceMs(10);
+    }
+
+    lumi.setFrameCallback(onFrame);
+    lastHash = 0;
+    lumi.update();
+    frameHash = lastHash;
+    return (double)elapsed / frames;
+}
+
+int main(int argc, char** argv) {
+    bool quick = lumiBenchQuick(argc, argv);
+    static const uint16_t lengths[] = { 512, 1000, 2000, 4000, 8000, 16000 };
+
+    // With a single hardware thread the worker only adds handoff cost
+    printf("%u hardware threads\n", std::thread::hardware_concurrency());
+    printf("%6s  %14s  %14s  %8s\n", "leds", "1 core us/fr", "2 cores us/fr", "speedup");
+    for (uint16_t numLeds : lengths) {
+        uint32_t frames = quick ? 10 : 10000000 / numLeds;
+        uint32_t singleHash, parallelHash;
+        double single = timeFrames(numLeds, false, frames, singleHash);
+        double parallel = timeFrames(numLeds, true, frames, parallelHash);
+        LUMI_CHECK(singleHash != 0);
+        LUMI_CHECK_EQ(parallelHash, singleHash);
+        printf("%6u  %14.1f  %14.1f  %7.2fx\n", numLeds, single / 1000, parallel / 1000, single / parallel);
+    }
+    return lumiTestResult("parallel_bench");
+}
@@ -0,0 +1,151 @@
+/*
+ * AvantLumi Library - Preset Store Test
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * Scenes are saved to the host EEPROM, found by name, recalled into a fresh
+ * instance and deleted. Slots with a bad palette id or brightness level are
+ * written straight into EEPROM; recalling one must fail and leave the
+ * current scene exactly as it was.
+ */
+
+#include <AvantLumi.h>
+#include <LumiHost.h>
+#include "lumi_test.h"
+
+#define TEST_LEDS 30
+
+// Offset of the slot's marker byte, found through the name stored after it.
+// Slot layout: marker, flags, paletteId, colorId, brightness, speed, r, g, b, name.
+static int findSlot(const char* name) {
+    size_t length = strlen(name);
+    for (size_t i = 9; i + length < EEPROM.length(); i++) {
+        bool match = true;
+        for (size_t c = 0; c <= length && match; c++) {
+            match = EEPROM.read(i + c) == (uint8_t)name[c];
+        }
+        if (match) {
+            return (int)i - 9;
+        }
+    }
+    return -1;
+}
+
+static void setScene(AvantLumi& lumi) {
+    lumi.setSwitch(true);
+    lumi.setFade(false);
+    lumi.setBright(4);
+    lumi.setBlendSpeed(2);
+    lumi.setPalette("forest");
+}
+
+static void checkScene(AvantLumi& lumi) {
+    LUMI_CHECK(lumi.getSwitch());
+    LUMI_CHECK(!lumi.getFade());
+    LUMI_CHECK_EQ(lumi.getBright(), 4);
+    LUMI_CHECK_EQ(lumi.getBlendSpeed(), 2);
+    LUMI_CHECK(lumi.getPalette() == "forest");
+}
+
+static void testSaveRecallFind() {
+    EEPROM.erase();
+    FastLED.reset();
+    {
+        AvantLumi lumi(5, TEST_LEDS);
+        LUMI_CHECK(lumi.begin());
+        LUMI_CHECK(!lumi.hasPreset(0));
+        LUMI_CHECK(!lumi.recallPreset(0));
+
+        lumi.setPalette("ocean");
+        lumi.setBright(2);
+        lumi.setFade(true);
+        lumi.setBlendSpeed(3);
+        LUMI_CHECK(lumi.savePreset(0, "evening"));
+
+        lumi.setRGB(255, 0, 0);
+        lumi.setBright(5);
+        lumi.setFade(false);
+        LUMI_CHECK(lumi.savePreset(1, "alarm"));
+
+        lumi.setColor("blue");
+        lumi.setSwitch(false);
+        LUMI_CHECK(lumi.savePreset(LUMI_MAX_PRESETS - 1, "night"));
+        LUMI_CHECK(!lumi.savePreset(LUMI_MAX_PRESETS, "none"));
+    }
+
+    // The store outlives the instance
+    AvantLumi lumi(5, TEST_LEDS);
+    LUMI_CHECK(lumi.begin());
+    LUMI_CHECK(lumi.hasPreset(0) && lumi.hasPreset(1) && lumi.hasPreset(LUMI_MAX_PRESETS - 1));
+    LUMI_CHECK(!lumi.hasPreset(2));
+    LUMI_CHECK(lumi.getPresetName(1) == "alarm");
+    LUMI_CHECK_EQ(lumi.findPreset("evening"), 0);
+    LUMI_CHECK_EQ(lumi.findPreset("night"), LUMI_MAX_PRESETS - 1);
+    LUMI_CHECK_EQ(lumi.findPreset("morning"), -1);
+
+    LUMI_CHECK(lumi.recallPreset(0));
+    LUMI_CHECK(lumi.getPalette() == "ocean");
+    LUMI_CHECK_EQ(lumi.getBright(), 2);
+    LUMI_CHECK(lumi.getFade());
+    LUMI_CHECK_EQ(lumi.getBlendSpeed(), 3);
+
+    LUMI_CHECK(lumi.recallPreset(1));
+    LUMI_CHECK_EQ(lumi.getPaletteId(), LUMI_PALETTE_SOLID);
+    LUMI_CHECK(lumi.getColor() == "");   // Plain RGB, not a named color
+    LUMI_CHECK_EQ(lumi.getBright(), 5);
+    LUMI_CHECK(!lumi.getFade());
+
+    LUMI_CHECK(lumi.recallPreset(LUMI_MAX_PRESETS - 1));
+    LUMI_CHECK(lumi.getColor() == "blue");
+    LUMI_CHECK(!lumi.getSwitch());
+    LUMI_CHECK(!lumi.recallPreset(LUMI_MAX_PRESETS));
+
+    LUMI_CHECK(lumi.deletePreset(1));
+    LUMI_CHECK(!lumi.hasPreset(1));
+    LUMI_CHECK(!lumi.recallPreset(1));
+    LUMI_CHECK_EQ(lumi.findPreset("alarm"), -1);
+    LUMI_CHECK(lumi.hasPreset(0));
+}
+
+static void testCorruptSlot() {
+    EEPROM.erase();
+    FastLED.reset();
+    AvantLumi lumi(5, TEST_LEDS);
+    LUMI_CHECK(lumi.begin());
+    lumi.setPalette("lava");
+    lumi.setBright(1);
+    lumi.setFade(true);
+    LUMI_CHECK(lumi.savePreset(3, "broken"));
+    int slot = findSlot("broken");
+    LUMI_CHECK(slot >= 0);
+    LUMI_CHECK_EQ(EEPROM.read(slot), 0xA5);
+
+    // Palette id past the table: marker, brightness and speed are all valid
+    EEPROM.write(slot + 2, LUMI_PALETTE_COUNT + 3);
+    LUMI_CHECK(lumi.hasPreset(3));
+    setScene(lumi);
+    uint32_t version = lumi.getStatusVersion();
+    LUMI_CHECK(!lumi.recallPreset(3));
+    checkScene(lumi);
+    LUMI_CHECK_EQ(lumi.getStatusVersion(), version);
+
+    // Brightness level out of range
+    EEPROM.write(slot + 2, LUMI_PALETTE_OCEAN);
+    EEPROM.write(slot + 4, 9);
+    LUMI_CHECK(!lumi.recallPreset(3));
+    checkScene(lumi);
+
+    // Repaired, the slot recalls again
+    EEPROM.write(slot + 4, 3);
+    LUMI_CHECK(lumi.recallPreset(3));
+    LUMI_CHECK(lumi.getPalette() == "ocean");
+    LUMI_CHECK_EQ(lumi.getBright(), 3);
+    LUMI_CHECK(lumi.getFade());
+}
+
+int main() {
+    testSaveRecallFind();
+    testCorruptSlot();
+    return lumiTestResult("preset");
+}
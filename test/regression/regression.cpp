@@ -0,0 +1,338 @@
+/*
+ * AvantLumi Library - Frame Regression Harness
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * Replays a command script on the simulated clock and checks the hash of
+ * every frame handed to FastLED against a golden file.
+ *
+ *   lumi_regression [--update] [--ppm DIR] script.lumi golden.txt
+ *
+ * --update rewrites the golden file from this run. --ppm also writes the
+ * frames as images: one image per frame for a matrix, or a single image with
+ * one row per frame for a strip. Pixels are scaled by the frame brightness.
+ *
+ * Script lines (# starts a comment):
+ *   leds N                     strip length, before begin (default 60)
+ *   matrix W H [rows|columns|serpentine|panel_serpentine]... [panel PW PH]
+ *   effect strip|linear|radial|plasma
+ *   double on|off              double-buffered show
+ *   precision 8|16             render path
+ *   parallel on|off
+ *   chunk LEDS [BUDGET_US]
+ *   interp MS                  frame interpolation
+ *   coalesce on|off
+ *   seed N                     shared show seed
+ *   begin
+ *   cmd {JSON}                 applyCommand(), must succeed
+ *   run FRAMES STEP_MS         FRAMES x (update(), advance STEP_MS)
+ *   advance MS
+ */
+
+#include <AvantLumi.h>
+#include <LumiHost.h>
+#include <string>
+#include <vector>
+
+struct FrameRecord {
+    uint32_t timeMs;
+    uint32_t hash;
+};
+
+struct Harness {
+    std::vector<FrameRecord> frames;
+    std::vector<uint8_t> image;         // Strip waterfall, one row per frame
+    std::string ppmDir;
+    std::string name;
+    AvantLumi* lumi;
+    uint16_t numLeds;
+};
+
+static Harness harness;
+
+static void writePpm(const std::string& path, int width, int height, const uint8_t* rgb) {
+    FILE* f = fopen(path.c_str(), "wb");
+    if (f == nullptr) {
+        fprintf(stderr, "cannot write %s\n", path.c_str());
+        return;
+    }
+    fprintf(f, "P6\n%d %d\n255\n", width, height);
+    fwrite(rgb, 1, (size_t)width * height * 3, f);
+    fclose(f);
+}
+
+static void onFrame(const CRGB* frame, uint16_t count, uint8_t brightness) {
+    FrameRecord record;
+    record.timeMs = millis();
+    record.hash = AvantLumi::frameHash(frame, count, brightness);
+    harness.frames.push_back(record);
+
+    if (harness.ppmDir.empty()) {
+        return;
+    }
+    AvantLumi& lumi = *harness.lumi;
+    uint8_t width = lumi.getMatrixWidth();
+    uint8_t height = lumi.getMatrixHeight();
+    if (width == 0) {
+        for (uint16_t i = 0; i < count; i++) {
+            for (uint8_t ch = 0; ch < 3; ch++) {
+                harness.image.push_back(scale8(frame[i].raw[ch], brightness));
+            }
+        }
+        return;
+    }
+
+    std::vector<uint8_t> rgb;
+    for (uint8_t y = 0; y < height; y++) {
+        for (uint8_t x = 0; x < width; x++) {
+            const CRGB& c = frame[lumi.XY(x, y)];
+            for (uint8_t ch = 0; ch < 3; ch++) {
+                rgb.push_back(scale8(c.raw[ch], brightness));
+            }
+        }
+    }
+    char file[64];
+    snprintf(file, sizeof(file), "_%04u.ppm", (unsigned)harness.frames.size() - 1);
+    writePpm(harness.ppmDir + "/" + harness.name + file, width, height, rgb.data());
+}
+
+static std::vector<std::string> split(const std::string& line) {
+    std::vector<std::string> words;
+    size_t pos = 0;
+    while (pos < line.size()) {
+        while (pos < line.size() && isspace((unsigned char)line[pos])) {
+            pos++;
+        }
+        size_t end = pos;
+        while (end < line.size() && !isspace((unsigned char)line[end])) {
+            end++;
+        }
+        if (end > pos) {
+            words.push_back(line.substr(pos, end - pos));
+        }
+        pos = end;
+    }
+    return words;
+}
+
+static bool fail(const std::string& script, int lineNo, const std::string& message) {
+    fprintf(stderr, "%s:%d: %s\n", script.c_str(), lineNo, message.c_str());
+    return false;
+}
+
+static bool runScript(const std::string& path) {
+    FILE* f = fopen(path.c_str(), "r");
+    if (f == nullptr) {
+        fprintf(stderr, "cannot open %s\n", path.c_str());
+        return false;
+    }
+    std::vector<std::string> lines;
+    char buffer[1024];
+    while (fgets(buffer, sizeof(buffer), f)) {
+        std::string line(buffer);
+        size_t hash = line.find('#');
+        if (hash != std::string::npos) {
+            line.erase(hash);
+        }
+        lines.push_back(line);
+    }
+    fclose(f);
+
+    lumiHostSetMicros(0);
+    FastLED.reset();
+
+    uint16_t numLeds = 60;
+    AvantLumi* lumi = nullptr;
+    bool ok = true;
+
+    // Settings made before begin() are kept here and applied in script order afterwards
+    for (size_t n = 0; n < lines.size() && ok; n++) {
+        int lineNo = (int)n + 1;
+        std::string line = lines[n];
+        std::vector<std::string> w = split(line);
+        if (w.empty()) {
+            continue;
+        }
+        const std::string& op = w[0];
+
+        if (op == "leds") {
+            if (lumi || w.size() != 2) {
+                ok = fail(path, lineNo, "leds N, before any other setting");
+                break;
+            }
+            numLeds = (uint16_t)atoi(w[1].c_str());
+            continue;
+        }
+
+        if (lumi == nullptr) {
+            lumi = new AvantLumi(5, numLeds);
+            lumi->setFrameCallback(onFrame);
+            harness.lumi = lumi;
+            harness.numLeds = numLeds;
+        }
+
+        if (op == "matrix" && w.size() >= 3) {
+            uint8_t layout = LUMI_MATRIX_ROWS, pw = 0, ph = 0;
+            for (size_t i = 3; i < w.size(); i++) {
+                if (w[i] == "columns") {
+                    layout |= LUMI_MATRIX_COLUMNS;
+                } else if (w[i] == "serpentine") {
+                    layout |= LUMI_MATRIX_SERPENTINE;
+                } else if (w[i] == "panel_serpentine") {
+                    layout |= LUMI_MATRIX_PANEL_SERPENTINE;
+                } else if (w[i] == "panel" && i + 2 < w.size()) {
+                    pw = atoi(w[i + 1].c_str());
+                    ph = atoi(w[i + 2].c_str());
+                    i += 2;
+                } else if (w[i] != "rows") {
+                    ok = fail(path, lineNo, "unknown matrix layout " + w[i]);
+                }
+            }
+            if (ok && !lumi->setMatrix(atoi(w[1].c_str()), atoi(w[2].c_str()), layout, pw, ph)) {
+                ok = fail(path, lineNo, "setMatrix() rejected the layout");
+            }
+        } else if (op == "effect" && w.size() == 2) {
+            static const char* const names[] = { "strip", "linear", "radial", "plasma" };
+            int effect = -1;
+            for (int i = 0; i < 4; i++) {
+                if (w[1] == names[i]) {
+                    effect = i;
+                }
+            }
+            if (effect < 0 || !lumi->setMatrixEffect((LumiMatrixEffect)effect)) {
+                ok = fail(path, lineNo, "unknown effect " + w[1]);
+            }
+        } else if (op == "double" && w.size() == 2) {
+            ok = lumi->setDoubleBuffer(w[1] == "on") || fail(path, lineNo, "setDoubleBuffer() failed");
+        } else if (op == "precision" && w.size() == 2) {
+            ok = lumi->setHighPrecision(w[1] == "16") || fail(path, lineNo, "setHighPrecision() failed");
+        } else if (op == "parallel" && w.size() == 2) {
+            ok = lumi->setParallelRender(w[1] == "on") || fail(path, lineNo, "setParallelRender() failed");
+        } else if (op == "chunk" && w.size() >= 2) {
+            uint32_t budget = w.size() > 2 ? atoi(w[2].c_str()) : 2000;
+            ok = lumi->setChunkedRender(atoi(w[1].c_str()), budget) || fail(path, lineNo, "setChunkedRender() failed");
+        } else if (op == "interp" && w.size() == 2) {
+            ok = lumi->setInterpolation(atoi(w[1].c_str())) || fail(path, lineNo, "setInterpolation() failed");
+        } else if (op == "coalesce" && w.size() == 2) {
+            lumi->setCoalescing(w[1] == "on");
+        } else if (op == "seed" && w.size() == 2) {
+            lumi->setShowSeed(strtoul(w[1].c_str(), nullptr, 0));
+        } else if (op == "begin") {
+            ok = lumi->begin() || fail(path, lineNo, "begin() failed");
+        } else if (op == "cmd") {
+            size_t start = line.find('{');
+            size_t end = line.rfind('}');
+            if (start == std::string::npos || end == std::string::npos) {
+                ok = fail(path, lineNo, "cmd needs a JSON object");
+                break;
+            }
+            std::string json = line.substr(start, end - start + 1);
+            LumiCommandResult result = lumi->applyCommand(json.c_str(), json.size());
+            if (result.error != LUMI_CMD_OK) {
+                ok = fail(path, lineNo, std::string("command failed: ") + AvantLumi::commandErrorText(result.error));
+            }
+        } else if (op == "run" && w.size() == 3) {
+            int count = atoi(w[1].c_str());
+            uint32_t step = atoi(w[2].c_str());
+            for (int i = 0; i < count; i++) {
+                lumi->update();
+                lumiHostAdvanceMs(step);
+            }
+        } else if (op == "advance" && w.size() == 2) {
+            lumiHostAdvanceMs(atoi(w[1].c_str()));
+        } else {
+            ok = fail(path, lineNo, "cannot parse: " + op);
+        }
+    }
+
+    delete lumi;
+    harness.lumi = nullptr;
+    return ok;
+}
+
+static std::string baseName(const std::string& path) {
+    size_t slash = path.find_last_of('/');
+    std::string name = slash == std::string::npos ? path : path.substr(slash + 1);
+    size_t dot = name.rfind('.');
+    return dot == std::string::npos ? name : name.substr(0, dot);
+}
+
+int main(int argc, char** argv) {
+    bool update = false;
+    std::vector<std::string> args;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--update") {
+            update = true;
+        } else if (arg == "--ppm" && i + 1 < argc) {
+            harness.ppmDir = argv[++i];
+        } else {
+            args.push_back(arg);
+        }
+    }
+    if (args.size() != 2) {
+        fprintf(stderr, "usage: lumi_regression [--update] [--ppm DIR] script.lumi golden.txt\n");
+        return 2;
+    }
+    const std::string& script = args[0];
+    const std::string& goldenPath = args[1];
+    harness.name = baseName(script);
+
+    if (!runScript(script)) {
+        return 1;
+    }
+    if (!harness.ppmDir.empty() && !harness.image.empty()) {
+        writePpm(harness.ppmDir + "/" + harness.name + ".ppm", harness.numLeds,
+                 (int)(harness.image.size() / (harness.numLeds * 3)), harness.image.data());
+    }
+
+    if (update) {
+        FILE* f = fopen(goldenPath.c_str(), "w");
+        if (f == nullptr) {
+            fprintf(stderr, "cannot write %s\n", goldenPath.c_str());
+            return 1;
+        }
+        for (size_t i = 0; i < harness.frames.size(); i++) {
+            fprintf(f, "%zu %u %08x\n", i, harness.frames[i].timeMs, harness.frames[i].hash);
+        }
+        fclose(f);
+        printf("%s: wrote %zu frames to %s\n", harness.name.c_str(), harness.frames.size(), goldenPath.c_str());
+        return 0;
+    }
+
+    FILE* f = fopen(goldenPath.c_str(), "r");
+    if (f == nullptr) {
+        fprintf(stderr, "cannot open %s (run with --update to create it)\n", goldenPath.c_str());
+        return 1;
+    }
+    size_t index;
+    unsigned timeMs, hash;
+    size_t expected = 0;
+    int mismatches = 0;
+    while (fscanf(f, "%zu %u %x", &index, &timeMs, &hash) == 3) {
+        if (expected < harness.frames.size()) {
+            const FrameRecord& got = harness.frames[expected];
+            if (got.timeMs != timeMs || got.hash != hash) {
+                if (mismatches < 5) {
+                    fprintf(stderr, "%s: frame %zu: got t=%u %08x, golden t=%u %08x\n", harness.name.c_str(),
+                            expected, got.timeMs, got.hash, timeMs, hash);
+                }
+                mismatches++;
+            }
+        }
+        expected++;
+    }
+    fclose(f);
+
+    if (expected != harness.frames.size()) {
+        fprintf(stderr, "%s: %zu frames shown, golden has %zu\n", harness.name.c_str(), harness.frames.size(), expected);
+        return 1;
+    }
+    if (mismatches) {
+        fprintf(stderr, "%s: %d of %zu frames differ\n", harness.name.c_str(), mismatches, expected);
+        return 1;
+    }
+    printf("%s: %zu frames match\n", harness.name.c_str(), expected);
+    return 0;
+}
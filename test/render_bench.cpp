@@ -0,0 +1,67 @@
+/*
+ * AvantLumi Library - 8-bit vs 16-bit Render Benchmark
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * Times update() with the 8-bit pipeline and with setHighPrecision() at
+ * several strip lengths, with fades on so every LED is drawn each frame,
+ * and reports the cost per LED and the extra cost of the 16-bit path:
+ *
+ *   build/render_bench
+ */
+
+#include <AvantLumi.h>
+#include <LumiHost.h>
+#include "lumi_bench.h"
+#include "lumi_test.h"
+
+static uint32_t shown = 0;
+
+static void onFrame(const CRGB* frame, uint16_t count, uint8_t brightness) {
+    shown++;
+}
+
+// Wall-clock nanoseconds per update(), after a warm-up
+static double timeFrames(uint16_t numLeds, bool highPrecision, uint32_t frames) {
+    FastLED.reset();
+    lumiHostSetMicros(0);
+    AvantLumi lumi(5, numLeds);
+    LUMI_CHECK(lumi.begin());
+    lumi.setPalette("ocean");
+    lumi.setFade(true);
+    lumi.setBright(1);      // Night mode, where dithering matters
+    LUMI_CHECK(lumi.setHighPrecision(highPrecision));
+    lumi.setFrameCallback(onFrame);
+    for (int i = 0; i < 50; i++) {
+        lumi.update();
+        lumiHostAdvanceMs(10);
+    }
+
+    shown = 0;
+    uint64_t elapsed = 0;
+    for (uint32_t i = 0; i < frames; i++) {
+        uint64_t start = lumiBenchNs();
+        lumi.update();
+        elapsed += lumiBenchNs() - start;
+        lumiHostAdvanceMs(10);
+    }
+    LUMI_CHECK_EQ(shown, frames);
+    return (double)elapsed / frames;
+}
+
+int main(int argc, char** argv) {
+    bool quick = lumiBenchQuick(argc, argv);
+    static const uint16_t lengths[] = { 60, 300, 1200, 4800 };
+
+    printf("%6s  %12s  %12s  %13s  %13s  %6s\n",
+           "leds", "8-bit us/fr", "16-bit us/fr", "8-bit ns/led", "16-bit ns/led", "16/8");
+    for (uint16_t numLeds : lengths) {
+        uint32_t frames = quick ? 20 : 10000000 / numLeds;
+        double base = timeFrames(numLeds, false, frames);
+        double precise = timeFrames(numLeds, true, frames);
+        printf("%6u  %12.1f  %12.1f  %13.2f  %13.2f  %5.2fx\n",
+               numLeds, base / 1000, precise / 1000, base / numLeds, precise / numLeds, precise / base);
+    }
+    return lumiTestResult("render_bench");
+}
@@ -0,0 +1,176 @@
+/*
+ * AvantLumi Library - Status Serialization Test
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * The status JSON is serialized once per state change however many
+ * dashboards are connected to a LumiStatusStream, and polling getStatusText()
+ * hands out the same text until the state changes or a second has passed.
+ */
+
+#include <AvantLumi.h>
+#include <LumiHost.h>
+#include <LumiStatusStream.h>
+#include <memory>
+#include "lumi_test.h"
+
+// Arduino Client stand-in; copies share the connection, like WiFiClient
+class FakeClient {
+private:
+    struct Connection {
+        std::string received;
+        bool open = true;
+    };
+    std::shared_ptr<Connection> connection;
+
+public:
+    FakeClient() : connection(std::make_shared<Connection>()) {}
+
+    uint8_t connected() { return connection->open; }
+    void stop() { connection->open = false; }
+    size_t write(const uint8_t* buffer, size_t size) {
+        connection->received.append((const char*)buffer, size);
+        return size;
+    }
+
+    // Test side
+    void hangUp() { connection->open = false; }
+    size_t events() {
+        size_t count = 0;
+        for (size_t pos = 0; (pos = connection->received.find("data: ", pos)) != std::string::npos; pos++) {
+            count++;
+        }
+        return count;
+    }
+    bool endsWith(const String& status) {
+        std::string tail = std::string("data: ") + status.c_str() + "\n\n";
+        const std::string& text = connection->received;
+        return text.size() >= tail.size() && text.compare(text.size() - tail.size(), tail.size(), tail) == 0;
+    }
+};
+
+static void testSerializationsPerClientCount() {
+    const uint32_t changes = 25;
+    for (uint8_t clients = 0; clients <= LUMI_STATUS_MAX_CLIENTS; clients++) {
+        FastLED.reset();
+        AvantLumi lumi(5, 30);
+        LUMI_CHECK(lumi.begin());
+        LumiStatusStream<FakeClient> stream;
+        FakeClient dashboards[LUMI_STATUS_MAX_CLIENTS];
+        for (uint8_t i = 0; i < clients; i++) {
+            LUMI_CHECK(stream.addClient(dashboards[i], lumi));
+        }
+        uint32_t before = lumi.getStatusSerializations();
+
+        for (uint32_t n = 0; n < changes; n++) {
+            lumi.setBright(1 + n % 5);
+            lumi.setPalette(n % 2 ? "ocean" : "lava");   // Two setters, one push
+            lumi.update();
+            stream.update(lumi);
+            lumiHostAdvanceMs(20);
+        }
+
+        uint32_t serializations = lumi.getStatusSerializations() - before;
+        printf("status_test: %u clients, %u changes: %u serializations\n", clients, changes, serializations);
+        LUMI_CHECK_EQ(serializations, clients ? changes : 0);
+        for (uint8_t i = 0; i < clients; i++) {
+            LUMI_CHECK_EQ(dashboards[i].events(), changes + 1);   // Plus the status on connect
+            LUMI_CHECK(dashboards[i].endsWith(lumi.getStatusJson()));
+        }
+    }
+}
+
+static void testClientSlots() {
+    FastLED.reset();
+    AvantLumi lumi(5, 30);
+    LUMI_CHECK(lumi.begin());
+    LumiStatusStream<FakeClient> stream;
+    FakeClient dashboards[LUMI_STATUS_MAX_CLIENTS + 1];
+    for (uint8_t i = 0; i < LUMI_STATUS_MAX_CLIENTS; i++) {
+        LUMI_CHECK(stream.addClient(dashboards[i], lumi));
+    }
+    LUMI_CHECK(!stream.addClient(dashboards[LUMI_STATUS_MAX_CLIENTS], lumi));
+
+    // A closed dashboard frees its slot
+    dashboards[1].hangUp();
+    LUMI_CHECK(stream.addClient(dashboards[LUMI_STATUS_MAX_CLIENTS], lumi));
+    LUMI_CHECK_EQ(stream.clientCount(), LUMI_STATUS_MAX_CLIENTS);
+
+    // Keep-alive comments only after a quiet period
+    size_t events = dashboards[0].events();
+    lumiHostAdvanceMs(LUMI_STATUS_KEEPALIVE_MS);
+    stream.update(lumi);
+    LUMI_CHECK_EQ(dashboards[0].events(), events);
+    LUMI_CHECK(stream.clientCount() == LUMI_STATUS_MAX_CLIENTS);
+    stream.closeAll();
+    LUMI_CHECK_EQ(stream.clientCount(), 0);
+}
+
+static void testStatusPolling() {
+    FastLED.reset();
+    AvantLumi lumi(5, 30);
+    LUMI_CHECK(lumi.begin());
+
+    // Same buffer every time: polling neither serializes nor allocates
+    const char* first = lumi.getStatusText();
+    String copy = lumi.getStatus();
+    LUMI_CHECK(copy == first);
+    LUMI_CHECK("Status: " + lumi.getStatus() == "Status: " + copy);
+    uint32_t serializations = lumi.getStatusSerializations();
+    for (int i = 0; i < 1000; i++) {
+        LUMI_CHECK(lumi.getStatusText() == first);
+    }
+    LUMI_CHECK_EQ(lumi.getStatusSerializations(), serializations);
+
+    // A change shows up at once
+    lumi.setBright(5);
+    LUMI_CHECK(strstr(lumi.getStatusText(), "\"bright\":5") != nullptr);
+    LUMI_CHECK_EQ(lumi.getStatusSerializations(), serializations + 1);
+
+    // The live text starts with the state JSON, less its closing brace
+    String state = lumi.getStatusJson();
+    LUMI_CHECK(strncmp(lumi.getStatusText(), state.c_str(), state.length() - 1) == 0);
+
+    // Live figures are held for LUMI_STATUS_LIVE_MS: the frame showing the
+    // change records its latency without changing the state version
+    LUMI_CHECK(copy.indexOf("\"mem\":{") > 0);
+    LUMI_CHECK(strstr(lumi.getStatusText(), "\"lat\":{\"n\":0,") != nullptr);
+    lumi.update();
+    LUMI_CHECK_EQ(lumi.getLatencyStats().count, 1);
+    lumiHostAdvanceMs(LUMI_STATUS_LIVE_MS - 1);
+    LUMI_CHECK(strstr(lumi.getStatusText(), "\"lat\":{\"n\":0,") != nullptr);
+    lumiHostAdvanceMs(1);
+    LUMI_CHECK(strstr(lumi.getStatusText(), "\"lat\":{\"n\":1,") != nullptr);
+    LUMI_CHECK_EQ(lumi.getStatusSerializations(), serializations + 1);
+}
+
+static void testStatusText() {
+    FastLED.reset();
+    AvantLumi lumi(5, 30);
+    LUMI_CHECK(lumi.begin());
+
+    // Same text the String-built status used to produce
+    lumi.setPalette("ocean");
+    lumi.setBright(3);
+    lumi.setFade(false);
+    LUMI_CHECK(String(lumi.getStatusJson()) ==
+               "{\"switch\":\"on\",\"bright\":3,\"fade\":\"off\",\"palette\":\"ocean\","
+               "\"power\":{\"v\":5,\"ma\":500},\"blend_spd\":4}");
+    lumi.setRGB(1, 20, 255);
+    LUMI_CHECK(strstr(lumi.getStatusJson(), "\"rgb\":{\"r\":1,\"g\":20,\"b\":255},") != nullptr);
+
+    // Even if each of the 21 live figures grew by ten digits, the text would
+    // still fit its fixed buffer
+    const char* status = lumi.getStatusText();
+    LUMI_CHECK(strlen(status) + 21 * 10 < LUMI_STATUS_SIZE);
+    LUMI_CHECK(status[strlen(status) - 1] == '}');
+}
+
+int main() {
+    testSerializationsPerClientCount();
+    testClientSlots();
+    testStatusPolling();
+    testStatusText();
+    return lumiTestResult("status_test");
+}
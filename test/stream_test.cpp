@@ -0,0 +1,259 @@
+/*
+ * AvantLumi Library - Pixel Stream Loopback Test
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * An E1.31 sender on the loopback network streams a strip that spans three
+ * universes, each with its own sequence counter as sACN senders number them.
+ * Every frame must arrive intact; a replayed packet is dropped only in its
+ * own universe. A DDP sender streams the same strip in offset-addressed
+ * packets, pushing on the last one; a lost packet must show as a sequence
+ * gap. Finally the receive path of both protocols is timed in frames and
+ * packets per second.
+ */
+
+#include <AvantLumi.h>
+#include <LumiHost.h>
+#include <chrono>
+#include "lumi_test.h"
+
+#define TEST_LEDS 400
+#define TEST_UNIVERSES 3
+
+static const IPAddress NODE_IP(10, 0, 0, 1);
+static const IPAddress SENDER_IP(10, 0, 0, 2);
+
+static uint32_t framesSeen = 0;
+static CRGB lastFrame[TEST_LEDS];
+
+static void onFrame(const CRGB* frame, uint16_t count, uint8_t brightness) {
+    framesSeen++;
+    memcpy(lastFrame, frame, count * sizeof(CRGB));
+}
+
+static CRGB pattern(uint32_t frame, uint16_t led) {
+    return CRGB((uint8_t)(frame + led), (uint8_t)(frame * 3), (uint8_t)(led >> 1));
+}
+
+static void buildPacket(uint8_t* packet, uint16_t universe, uint8_t sequence, uint32_t frame, uint16_t& length) {
+    static const uint8_t acnId[12] = { 'A', 'S', 'C', '-', 'E', '1', '.', '1', '7', 0, 0, 0 };
+    uint16_t first = (universe - 1) * LUMI_E131_PIXELS_PER_UNIVERSE;
+    uint16_t pixels = min(TEST_LEDS - first, LUMI_E131_PIXELS_PER_UNIVERSE);
+
+    memset(packet, 0, 126);
+    memcpy(packet + 4, acnId, sizeof(acnId));
+    packet[111] = sequence;
+    packet[113] = universe >> 8;
+    packet[114] = universe & 0xFF;
+    packet[123] = (pixels * 3 + 1) >> 8;
+    packet[124] = (pixels * 3 + 1) & 0xFF;
+    for (uint16_t i = 0; i < pixels; i++) {
+        CRGB c = pattern(frame, first + i);
+        memcpy(packet + 126 + i * 3, c.raw, 3);
+    }
+    length = 126 + pixels * 3;
+}
+
+// DDP packets carry at most this many pixels, so a frame takes three
+#define DDP_PIXELS_PER_PACKET 160
+#define DDP_PACKETS ((TEST_LEDS + DDP_PIXELS_PER_PACKET - 1) / DDP_PIXELS_PER_PACKET)
+
+static void buildDdpPacket(uint8_t* packet, uint8_t index, uint8_t sequence, uint32_t frame, uint16_t& length) {
+    uint16_t first = index * DDP_PIXELS_PER_PACKET;
+    uint16_t pixels = min(TEST_LEDS - first, DDP_PIXELS_PER_PACKET);
+    uint32_t offset = first * 3;
+
+    packet[0] = 0x40 | (index == DDP_PACKETS - 1 ? 0x01 : 0);  // Version 1, push on the last
+    packet[1] = sequence;
+    packet[2] = 0x0B;       // RGB, 8 bits per channel
+    packet[3] = 1;          // Display
+    packet[4] = offset >> 24;
+    packet[5] = offset >> 16;
+    packet[6] = offset >> 8;
+    packet[7] = offset;
+    packet[8] = (pixels * 3) >> 8;
+    packet[9] = (pixels * 3) & 0xFF;
+    for (uint16_t i = 0; i < pixels; i++) {
+        CRGB c = pattern(frame, first + i);
+        memcpy(packet + 10 + i * 3, c.raw, 3);
+    }
+    length = 10 + pixels * 3;
+}
+
+// Sequence numbers run 1-15; skip leaves one packet out
+static void sendDdpFrame(LoopbackUdp& sender, uint8_t& sequence, uint32_t frame, int skip = -1) {
+    uint8_t packet[10 + DDP_PIXELS_PER_PACKET * 3];
+    for (uint8_t p = 0; p < DDP_PACKETS; p++) {
+        uint16_t length;
+        buildDdpPacket(packet, p, sequence, frame, length);
+        sequence = sequence % 15 + 1;
+        if (p == skip) {
+            continue;
+        }
+        sender.beginPacket(NODE_IP, LUMI_DDP_PORT);
+        sender.write(packet, length);
+        sender.endPacket();
+    }
+}
+
+static void sendFrame(LoopbackUdp& sender, uint8_t* sequences, uint32_t frame) {
+    uint8_t packet[126 + 512];
+    for (uint16_t u = 1; u <= TEST_UNIVERSES; u++) {
+        uint16_t length;
+        buildPacket(packet, u, sequences[u - 1]++, frame, length);
+        sender.beginPacket(NODE_IP, LUMI_E131_PORT);
+        sender.write(packet, length);
+        sender.endPacket();
+    }
+}
+
+static bool frameMatches(uint32_t frame) {
+    for (uint16_t i = 0; i < TEST_LEDS; i++) {
+        if (lastFrame[i] != pattern(frame, i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void testUniverseSequences() {
+    FastLED.reset();
+    LoopbackNetwork network;
+    LoopbackUdp nodeUdp(network, NODE_IP);
+    LoopbackUdp sender(network, SENDER_IP);
+    AvantLumi lumi(5, TEST_LEDS);
+    LUMI_CHECK(lumi.begin());
+    lumi.setFrameCallback(onFrame);
+    LUMI_CHECK(lumi.beginPixelStream(nodeUdp, LUMI_STREAM_E131));
+    framesSeen = 0;
+
+    // Universes start their counters at different points, as they do after
+    // a sender adds a universe mid-show
+    uint8_t sequences[TEST_UNIVERSES] = { 10, 200, 0 };
+    const uint32_t frames = 200;   // 5 s at 40 fps
+    uint32_t shownBefore = 0;
+    for (uint32_t f = 0; f < frames; f++) {
+        sendFrame(sender, sequences, f);
+        for (int step = 0; step < 5; step++) {
+            lumi.update();
+            lumiHostAdvanceMs(5);
+        }
+        if (f == 0) {
+            shownBefore = framesSeen;
+        }
+    }
+    LumiStreamStats stats = lumi.getStreamStats();
+    LUMI_CHECK_EQ(stats.packets, frames * TEST_UNIVERSES);
+    LUMI_CHECK_EQ(stats.frames, frames);
+    LUMI_CHECK_EQ(stats.dropped, 0);
+    LUMI_CHECK_EQ(stats.outOfOrder, 0);
+    LUMI_CHECK(lumi.isExternalFrame());
+    LUMI_CHECK(frameMatches(frames - 1));
+    LUMI_CHECK(framesSeen - shownBefore >= frames - 1);
+
+    // A replay of universe 2's last packet is stale for universe 2 only
+    uint8_t packet[126 + 512];
+    uint16_t length;
+    buildPacket(packet, 2, sequences[1] - 1, 0, length);
+    sender.beginPacket(NODE_IP, LUMI_E131_PORT);
+    sender.write(packet, length);
+    sender.endPacket();
+    sendFrame(sender, sequences, frames);
+    for (int step = 0; step < 5; step++) {
+        lumi.update();
+        lumiHostAdvanceMs(5);
+    }
+    stats = lumi.getStreamStats();
+    LUMI_CHECK_EQ(stats.dropped, 1);
+    LUMI_CHECK_EQ(stats.frames, frames + 1);
+    LUMI_CHECK(frameMatches(frames));
+}
+
+static void testDdp() {
+    FastLED.reset();
+    LoopbackNetwork network;
+    LoopbackUdp nodeUdp(network, NODE_IP);
+    LoopbackUdp sender(network, SENDER_IP);
+    AvantLumi lumi(5, TEST_LEDS);
+    LUMI_CHECK(lumi.begin());
+    lumi.setFrameCallback(onFrame);
+    LUMI_CHECK(lumi.beginPixelStream(nodeUdp, LUMI_STREAM_DDP));
+    framesSeen = 0;
+
+    // The sequence wraps from 15 to 1 every five frames
+    uint8_t sequence = 1;
+    const uint32_t frames = 100;
+    for (uint32_t f = 0; f < frames; f++) {
+        sendDdpFrame(sender, sequence, f);
+        for (int step = 0; step < 5; step++) {
+            lumi.update();
+            lumiHostAdvanceMs(5);
+        }
+        LUMI_CHECK(frameMatches(f));
+    }
+    LumiStreamStats stats = lumi.getStreamStats();
+    LUMI_CHECK_EQ(stats.packets, frames * DDP_PACKETS);
+    LUMI_CHECK_EQ(stats.frames, frames);
+    LUMI_CHECK_EQ(stats.bytes, frames * TEST_LEDS * 3);
+    LUMI_CHECK_EQ(stats.dropped, 0);
+    LUMI_CHECK_EQ(stats.outOfOrder, 0);
+    LUMI_CHECK(lumi.isExternalFrame());
+    LUMI_CHECK(framesSeen >= frames);
+
+    // A lost middle packet is a sequence gap; the push still completes a
+    // frame, holding the previous pixels where the packet was lost
+    sendDdpFrame(sender, sequence, frames, 1);
+    for (int step = 0; step < 5; step++) {
+        lumi.update();
+        lumiHostAdvanceMs(5);
+    }
+    stats = lumi.getStreamStats();
+    LUMI_CHECK_EQ(stats.outOfOrder, 1);
+    LUMI_CHECK_EQ(stats.frames, frames + 1);
+    LUMI_CHECK(lastFrame[0] == pattern(frames, 0));
+    LUMI_CHECK(lastFrame[DDP_PIXELS_PER_PACKET] == pattern(frames - 1, DDP_PIXELS_PER_PACKET));
+    LUMI_CHECK(lastFrame[TEST_LEDS - 1] == pattern(frames, TEST_LEDS - 1));
+}
+
+static void benchFramesPerSecond(LumiStreamProtocol protocol) {
+    FastLED.reset();
+    LoopbackNetwork network;
+    LoopbackUdp nodeUdp(network, NODE_IP);
+    LoopbackUdp sender(network, SENDER_IP);
+    AvantLumi lumi(5, TEST_LEDS);
+    LUMI_CHECK(lumi.begin());
+    LUMI_CHECK(lumi.beginPixelStream(nodeUdp, protocol));
+
+    uint8_t sequences[TEST_UNIVERSES] = { 0, 0, 0 };
+    uint8_t ddpSequence = 1;
+    const uint32_t frames = 20000;
+    LumiStreamStats before = lumi.getStreamStats();
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t f = 0; f < frames; f++) {
+        if (protocol == LUMI_STREAM_DDP) {
+            sendDdpFrame(sender, ddpSequence, f);
+        } else {
+            sendFrame(sender, sequences, f);
+        }
+        lumi.update();
+        lumiHostAdvanceUs(500);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    LumiStreamStats stats = lumi.getStreamStats();
+    uint32_t received = stats.frames - before.frames;
+    uint32_t packets = stats.packets - before.packets;
+    LUMI_CHECK_EQ(received, frames);
+    LUMI_CHECK_EQ(packets, frames * (protocol == LUMI_STREAM_DDP ? DDP_PACKETS : TEST_UNIVERSES));
+    printf("stream_test: %u LEDs over %s in %u packets, %.0f frames/s, %.0f packets/s through send, receive and show\n",
+           TEST_LEDS, protocol == LUMI_STREAM_DDP ? "DDP" : "E1.31", packets / received,
+           received / seconds, packets / seconds);
+}
+
+int main() {
+    testUniverseSequences();
+    testDdp();
+    benchFramesPerSecond(LUMI_STREAM_E131);
+    benchFramesPerSecond(LUMI_STREAM_DDP);
+    return lumiTestResult("stream_test");
+}
@@ -0,0 +1,129 @@
+/*
+ * AvantLumi Library - Synchronized Nodes Test
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * A master and a follower on the loopback network, with local clocks that are
+ * 987 s apart and loops running at different rates. Once synchronized, every
+ * frame the slow follower renders must equal the master's frame at the same
+ * show time, also while a blend-speed (legacy) palette change is in progress.
+ */
+
+#include <AvantLumi.h>
+#include <LumiHost.h>
+#include <map>
+#include "lumi_test.h"
+
+#define TEST_LEDS 60
+
+static uint32_t masterClock() {
+    return millis();
+}
+
+static uint32_t followerClock() {
+    return millis() + 987654;
+}
+
+static AvantLumi* rendering;
+static std::map<uint32_t, uint32_t> masterFrames;           // show time -> hash
+static std::vector<std::pair<uint32_t, uint32_t>> followerFrames;
+
+static AvantLumi* master;
+static AvantLumi* follower;
+
+static void onFrame(const CRGB* frame, uint16_t count, uint8_t brightness) {
+    uint32_t hash = AvantLumi::frameHash(frame, count, brightness);
+    uint32_t at = rendering->showTime();
+    if (rendering == master) {
+        masterFrames[at] = hash;
+    } else {
+        followerFrames.push_back(std::make_pair(at, hash));
+    }
+}
+
+// Advances both nodes one millisecond at a time; the follower's loop only
+// runs every followerLoopMs, as on a busier controller
+static void runNodes(uint32_t ms, uint32_t followerLoopMs) {
+    for (uint32_t i = 0; i < ms; i++) {
+        rendering = master;
+        master->update();
+        if (millis() % followerLoopMs == 0) {
+            rendering = follower;
+            follower->update();
+        }
+        lumiHostAdvanceMs(1);
+    }
+}
+
+static void testLegacyBlendInSync(uint8_t blendSpeed, uint32_t followerLoopMs) {
+    FastLED.reset();
+    lumiHostSetMicros(0);
+    LoopbackNetwork network;
+    network.setLatencyUs(1500);
+    LoopbackUdp masterUdp(network, IPAddress(10, 0, 0, 1));
+    LoopbackUdp followerUdp(network, IPAddress(10, 0, 0, 2));
+
+    AvantLumi a(5, TEST_LEDS);
+    AvantLumi b(6, TEST_LEDS);
+    master = &a;
+    follower = &b;
+    a.setSyncClock(masterClock);
+    b.setSyncClock(followerClock);
+    LUMI_CHECK(a.begin());
+    LUMI_CHECK(b.begin());
+    LUMI_CHECK(a.beginSync(masterUdp, LUMI_SYNC_MASTER));
+    LUMI_CHECK(b.beginSync(followerUdp, LUMI_SYNC_FOLLOWER));
+    a.setFrameCallback(onFrame);
+    b.setFrameCallback(onFrame);
+    for (AvantLumi* node : { &a, &b }) {
+        LUMI_CHECK(node->setPalette("ocean"));
+        LUMI_CHECK(node->setBlendSpeed(5));
+    }
+
+    // Sync up with a fast follower loop, so replies are read as they arrive and
+    // the offset estimate is exact, then let the first blend and the fade-in
+    // brightness ramp settle at the follower's own pace
+    runNodes(3000, 1);
+    runNodes(9000, followerLoopMs);
+    LUMI_CHECK(b.isSynced());
+    LUMI_CHECK_EQ(a.showTime(), b.showTime());
+    LUMI_CHECK(a.setBlendSpeed(blendSpeed));
+    LUMI_CHECK(b.setBlendSpeed(blendSpeed));
+
+    // Both nodes get the change at the same show time, between follower loops
+    masterFrames.clear();
+    followerFrames.clear();
+    uint32_t changeAt = a.showTime() + 17;
+    bool changedA = false, changedB = false;
+    for (uint32_t i = 0; i < 6000; i++) {
+        if (!changedA && a.showTime() >= changeAt) {
+            changedA = a.setPalette("lava");
+        }
+        if (!changedB && b.showTime() >= changeAt) {
+            changedB = b.setPalette("lava");
+        }
+        runNodes(1, followerLoopMs);
+    }
+    LUMI_CHECK(changedA && changedB);
+
+    size_t compared = 0, differing = 0;
+    for (const auto& frame : followerFrames) {
+        auto match = masterFrames.find(frame.first);
+        if (match != masterFrames.end()) {
+            compared++;
+            differing += (match->second != frame.second);
+        }
+    }
+    LUMI_CHECK(compared >= 6000 / followerLoopMs - 2);
+    LUMI_CHECK_EQ(differing, 0);
+    printf("sync_test: blend speed %u, follower loop %u ms: %zu frames compared, %zu differ\n",
+           blendSpeed, followerLoopMs, compared, differing);
+}
+
+int main() {
+    testLegacyBlendInSync(3, 40);
+    testLegacyBlendInSync(1, 70);
+    testLegacyBlendInSync(5, 15);
+    return lumiTestResult("sync_test");
+}
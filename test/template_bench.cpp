@@ -0,0 +1,83 @@
+/*
+ * AvantLumi Library - Fixed-Size Template Benchmark
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * Times update() on an AvantLumi and on an AvantLumiT of the same length,
+ * with fades on so every LED is drawn each frame, for the 8-bit and the
+ * 16-bit pipeline, and reports how much faster the fixed-size loops are:
+ *
+ *   build/template_bench
+ */
+
+#include <AvantLumi.h>
+#include <LumiHost.h>
+#include "lumi_bench.h"
+#include "lumi_test.h"
+
+static uint32_t lastHash = 0;
+
+static void onFrame(const CRGB* frame, uint16_t count, uint8_t brightness) {
+    lastHash = AvantLumi::frameHash(frame, count, brightness);
+}
+
+// Wall-clock nanoseconds per update(); frameHash receives the hash of the last frame
+static double timeFrames(AvantLumi& lumi, bool highPrecision, uint32_t frames, uint32_t& frameHash) {
+    FastLED.reset();
+    lumiHostSetMicros(0);
+    LUMI_CHECK(lumi.begin());
+    lumi.setPalette("ocean");
+    lumi.setFade(true);
+    LUMI_CHECK(lumi.setHighPrecision(highPrecision));
+    for (int i = 0; i < 50; i++) {
+        lumi.update();
+        lumiHostAdvanceMs(10);
+    }
+
+    uint64_t elapsed = 0;
+    for (uint32_t i = 0; i < frames; i++) {
+        uint64_t start = lumiBenchNs();
+        lumi.update();
+        elapsed += lumiBenchNs() - start;
+        lumiHostAdvanceMs(10);
+    }
+
+    lumi.setFrameCallback(onFrame);
+    lastHash = 0;
+    lumi.update();
+    frameHash = lastHash;
+    return (double)elapsed / frames;
+}
+
+template<uint16_t NUM_LEDS>
+static void compare(bool quick, bool highPrecision) {
+    uint32_t frames = quick ? 20 : 10000000 / NUM_LEDS;
+    uint32_t runtimeHash, fixedHash;
+    double base, templated;
+    {
+        AvantLumi runtime(5, NUM_LEDS);
+        base = timeFrames(runtime, highPrecision, frames, runtimeHash);
+    }
+    {
+        AvantLumiT<5, NUM_LEDS> fixed;
+        templated = timeFrames(fixed, highPrecision, frames, fixedHash);
+    }
+    LUMI_CHECK(runtimeHash != 0);
+    LUMI_CHECK_EQ(fixedHash, runtimeHash);
+    printf("%6u  %7s  %14.1f  %14.1f  %7.2fx\n", NUM_LEDS, highPrecision ? "16-bit" : "8-bit",
+           base / 1000, templated / 1000, base / templated);
+}
+
+int main(int argc, char** argv) {
+    bool quick = lumiBenchQuick(argc, argv);
+
+    printf("%6s  %7s  %14s  %14s  %8s\n", "leds", "path", "AvantLumi us", "AvantLumiT us", "speedup");
+    for (bool highPrecision : { false, true }) {
+        compare<60>(quick, highPrecision);
+        compare<300>(quick, highPrecision);
+        compare<1200>(quick, highPrecision);
+        compare<4800>(quick, highPrecision);
+    }
+    return lumiTestResult("template_bench");
+}
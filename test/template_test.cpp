@@ -0,0 +1,124 @@
+/*
+ * AvantLumi Library - Fixed-Size Template Test
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * AvantLumiT renders, blends and copies whole frames with loops instantiated
+ * for its LED count. The same show is played on an AvantLumi and on an
+ * AvantLumiT of the same length, and every shown frame must be identical:
+ * plain and 16-bit rendering, fades, matrix effects, keyframe interpolation,
+ * double buffering and chunked rendering.
+ */
+
+#include <AvantLumi.h>
+#include <LumiHost.h>
+#include <vector>
+#include "lumi_test.h"
+
+#define TEST_LEDS 64
+#define TEST_FRAMES 300
+
+static std::vector<uint32_t> hashes;
+
+static void onFrame(const CRGB* frame, uint16_t count, uint8_t brightness) {
+    hashes.push_back(AvantLumi::frameHash(frame, count, brightness));
+}
+
+// Counts the calls that reach the fixed-size loops
+class CountingStrip : public AvantLumiT<5, TEST_LEDS> {
+public:
+    uint32_t frames = 0;
+    uint32_t blends = 0;
+
+protected:
+    uint16_t renderFrame(uint16_t seed) override {
+        frames++;
+        return AvantLumiT<5, TEST_LEDS>::renderFrame(seed);
+    }
+
+    void blendFrame(uint8_t mix) override {
+        blends++;
+        AvantLumiT<5, TEST_LEDS>::blendFrame(mix);
+    }
+};
+
+typedef void (*SetupFn)(AvantLumi& lumi);
+
+static std::vector<uint32_t> play(AvantLumi& lumi, SetupFn setup) {
+    FastLED.reset();
+    lumiHostSetMicros(0);
+    hashes.clear();
+    LUMI_CHECK(lumi.begin());
+    lumi.setFrameCallback(onFrame);
+    setup(lumi);
+    for (int i = 0; i < TEST_FRAMES; i++) {
+        if (i == 100) {
+            lumi.setPalette("lava");
+        }
+        if (i == 200) {
+            lumi.setBright(2);
+        }
+        lumi.update();
+        lumiHostAdvanceMs(10);
+    }
+    return hashes;
+}
+
+static void compare(const char* name, SetupFn setup, bool blends) {
+    AvantLumi runtime(5, TEST_LEDS);
+    std::vector<uint32_t> expected = play(runtime, setup);
+    CountingStrip fixed;
+    std::vector<uint32_t> actual = play(fixed, setup);
+
+    if (actual != expected) {
+        fprintf(stderr, "%s: frames differ\n", name);
+    }
+    LUMI_CHECK(expected.size() > TEST_FRAMES / 2);
+    LUMI_CHECK(actual == expected);
+    LUMI_CHECK(fixed.frames > 0);
+    LUMI_CHECK(blends ? fixed.blends > 0 : fixed.blends == 0);
+}
+
+static void setupFade(AvantLumi& lumi) {
+    lumi.setPalette("ocean");
+    lumi.setFade(true);
+}
+
+static void setupHighPrecision(AvantLumi& lumi) {
+    setupFade(lumi);
+    LUMI_CHECK(lumi.setHighPrecision(true));
+}
+
+static void setupMatrix(AvantLumi& lumi) {
+    lumi.setPalette("party");
+    LUMI_CHECK(lumi.setMatrix(8, 8));
+    LUMI_CHECK(lumi.setMatrixEffect(LUMI_MATRIX_PLASMA));
+}
+
+static void setupInterpolation(AvantLumi& lumi) {
+    setupFade(lumi);
+    LUMI_CHECK(lumi.setInterpolation(40));
+}
+
+static void setupDoubleBuffer(AvantLumi& lumi) {
+    setupHighPrecision(lumi);
+    LUMI_CHECK(lumi.setDoubleBuffer(true));
+    LUMI_CHECK(lumi.setInterpolation(30));
+}
+
+static void setupChunked(AvantLumi& lumi) {
+    setupFade(lumi);
+    LUMI_CHECK(lumi.setChunkedRender(TEST_LEDS));
+}
+
+int main() {
+    compare("fade", setupFade, false);
+    compare("high precision", setupHighPrecision, false);
+    compare("matrix", setupMatrix, false);
+    compare("interpolation", setupInterpolation, true);
+    compare("double buffer", setupDoubleBuffer, true);
+    compare("chunked", setupChunked, false);
+    LUMI_CHECK_EQ((AvantLumiT<5, TEST_LEDS>::ledCount), TEST_LEDS);
+    return lumiTestResult("template");
+}
@@ -0,0 +1,209 @@
+/*
+ * AvantLumi Library - Show Timeline Tests
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * Show files are written to disk and played on the simulated clock. Every
+ * keyframe must fire in order, including across the 16-keyframe chunks the
+ * player reads at a time, a looping show must wrap at its duration, and
+ * seeking must restore the same state as playing up to that point.
+ */
+
+#include <AvantLumi.h>
+#include <LumiHost.h>
+#include <vector>
+#include "lumi_test.h"
+
+#define TEST_LEDS 30
+#define TEST_FILE "timeline_test.lumt"
+
+static void putLE32(FILE* file, uint32_t value) {
+    uint8_t bytes[4] = { (uint8_t)value, (uint8_t)(value >> 8), (uint8_t)(value >> 16), (uint8_t)(value >> 24) };
+    fwrite(bytes, 1, 4, file);
+}
+
+static void writeShow(const std::vector<LumiKeyframe>& keyframes, bool loop, uint32_t duration) {
+    FILE* file = fopen(TEST_FILE, "wb");
+    LUMI_CHECK(file != nullptr);
+    fwrite("LUMT", 1, 4, file);
+    uint8_t version[4] = { LUMI_TIMELINE_VERSION, (uint8_t)(loop ? 1 : 0), 0, 0 };
+    fwrite(version, 1, 4, file);
+    putLE32(file, keyframes.size());
+    putLE32(file, duration);
+    for (const LumiKeyframe& kf : keyframes) {
+        putLE32(file, kf.time);
+        uint8_t args[4] = { kf.type, kf.a, kf.b, kf.c };
+        fwrite(args, 1, 4, file);
+    }
+    fclose(file);
+}
+
+static LumiKeyframe keyframe(uint32_t time, uint8_t type, uint8_t a, uint8_t b = 0, uint8_t c = 0) {
+    LumiKeyframe kf = { time, type, a, b, c };
+    return kf;
+}
+
+// 50 keyframes 100ms apart, spanning four chunks. Every fifth sets the
+// brightness, the rest set a red level equal to their index. Keyframe 20
+// recalls preset 0 and keyframe 23 an empty slot.
+static std::vector<LumiKeyframe> longShow() {
+    std::vector<LumiKeyframe> keyframes;
+    for (uint8_t i = 0; i < 50; i++) {
+        if (i == 20) {
+            keyframes.push_back(keyframe(i * 100, LUMI_KF_PRESET, 0));
+        } else if (i == 23) {
+            keyframes.push_back(keyframe(i * 100, LUMI_KF_PRESET, 5));
+        } else if (i % 5 == 0) {
+            keyframes.push_back(keyframe(i * 100, LUMI_KF_BRIGHT, (i / 5) % 5 + 1));
+        } else {
+            keyframes.push_back(keyframe(i * 100, LUMI_KF_RGB, i, 0, 0));
+        }
+    }
+    return keyframes;
+}
+
+// Red level and brightness after playing keyframes up to positionMs
+static void expectedAt(const std::vector<LumiKeyframe>& keyframes, uint32_t positionMs,
+                       int& red, int& bright) {
+    red = -1;
+    bright = -1;
+    for (const LumiKeyframe& kf : keyframes) {
+        if (kf.time > positionMs) {
+            break;
+        }
+        if (kf.type == LUMI_KF_RGB) {
+            red = kf.a;
+        } else if (kf.type == LUMI_KF_BRIGHT) {
+            bright = kf.a;
+        } else if (kf.type == LUMI_KF_PRESET && kf.a == 0) {
+            red = -1;   // Preset 0 is the ocean palette
+            bright = 2;
+        }
+    }
+}
+
+static void checkState(AvantLumi& lumi, const std::vector<LumiKeyframe>& keyframes, uint32_t positionMs) {
+    int red, bright;
+    expectedAt(keyframes, positionMs, red, bright);
+    if (red >= 0) {
+        LUMI_CHECK_EQ(lumi.getPaletteId(), LUMI_PALETTE_SOLID);
+        LUMI_CHECK_EQ(lumi.getRGB().r, red);
+    } else if (positionMs >= 2000) {
+        LUMI_CHECK(lumi.getPalette() == "ocean");
+    }
+    if (bright >= 0) {
+        LUMI_CHECK_EQ(lumi.getBright(), bright);
+    }
+}
+
+static void savePreset() {
+    AvantLumi lumi(5, TEST_LEDS);
+    LUMI_CHECK(lumi.begin());
+    lumi.setPalette("ocean");
+    lumi.setBright(2);
+    lumi.setFade(true);
+    lumi.setBlendSpeed(3);
+    LUMI_CHECK(lumi.savePreset(0, "show"));
+}
+
+static void testPlayback() {
+    std::vector<LumiKeyframe> keyframes = longShow();
+    writeShow(keyframes, false, 0);
+    FastLED.reset();
+    lumiHostSetMicros(0);
+    AvantLumi lumi(5, TEST_LEDS);
+    LUMI_CHECK(lumi.begin());
+    LUMI_CHECK(lumi.playTimeline(TEST_FILE));
+    LUMI_CHECK(lumi.isTimelinePlaying());
+
+    // Every keyframe fires on time and in order, through all four chunks
+    for (uint32_t t = 0; t < 4900; t += 50) {
+        lumi.update();
+        LUMI_CHECK_EQ(lumi.getTimelinePosition(), t);
+        checkState(lumi, keyframes, t);
+        lumiHostAdvanceMs(50);
+    }
+
+    // Not looping: play stops once the last keyframe has fired
+    lumi.update();
+    LUMI_CHECK(!lumi.isTimelinePlaying());
+    LUMI_CHECK_EQ(lumi.getRGB().r, 49);
+}
+
+static void testLoop() {
+    std::vector<LumiKeyframe> keyframes;
+    keyframes.push_back(keyframe(0, LUMI_KF_RGB, 1, 0, 0));
+    keyframes.push_back(keyframe(100, LUMI_KF_RGB, 2, 0, 0));
+    keyframes.push_back(keyframe(200, LUMI_KF_RGB, 3, 0, 0));
+    writeShow(keyframes, true, 300);
+    FastLED.reset();
+    lumiHostSetMicros(0);
+    AvantLumi lumi(5, TEST_LEDS);
+    LUMI_CHECK(lumi.begin());
+    LUMI_CHECK(lumi.playTimeline(TEST_FILE));
+
+    // The loop flag in the header wraps at the 300ms duration, not at the last keyframe
+    static const uint32_t steps[] = { 0, 150, 250, 290, 300, 450, 550, 610, 890, 900 };
+    static const uint8_t reds[] =   { 1, 2,   3,   3,   1,   2,   3,   1,   3,   1 };
+    uint32_t now = 0;
+    for (size_t i = 0; i < sizeof(steps) / sizeof(steps[0]); i++) {
+        lumiHostAdvanceMs(steps[i] - now);
+        now = steps[i];
+        lumi.update();
+        LUMI_CHECK_EQ(lumi.getRGB().r, reds[i]);
+        LUMI_CHECK(lumi.isTimelinePlaying());
+    }
+
+    // Seeking past the end wraps into the loop
+    LUMI_CHECK(lumi.seekTimeline(1000));
+    LUMI_CHECK_EQ(lumi.getRGB().r, 2);
+    LUMI_CHECK_EQ(lumi.getTimelinePosition(), 100);
+}
+
+static void testSeek() {
+    std::vector<LumiKeyframe> keyframes = longShow();
+    writeShow(keyframes, false, 0);
+    FastLED.reset();
+    lumiHostSetMicros(0);
+    AvantLumi lumi(5, TEST_LEDS);
+    LUMI_CHECK(lumi.begin());
+    lumi.setFade(false);
+    lumi.setBlendSpeed(1);
+    LUMI_CHECK(lumi.playTimeline(TEST_FILE));
+    lumi.update();
+
+    // Forward and back across chunk boundaries; each seek restores the same
+    // state playing up to that point would
+    static const uint32_t positions[] = { 1650, 350, 4850, 1550, 3250, 40, 4900, 1600, 3199, 3200 };
+    for (uint32_t position : positions) {
+        LUMI_CHECK(lumi.seekTimeline(position));
+        LUMI_CHECK_EQ(lumi.getTimelinePosition(), position);
+        checkState(lumi, keyframes, position);
+    }
+
+    // The preset at 2000ms is restored, and the empty slot at 2300ms changes nothing
+    LUMI_CHECK(lumi.seekTimeline(2350));
+    checkState(lumi, keyframes, 2350);
+    LUMI_CHECK(lumi.getFade());
+    LUMI_CHECK_EQ(lumi.getBlendSpeed(), 3);
+    LUMI_CHECK(lumi.seekTimeline(2050));
+    LUMI_CHECK(lumi.getPalette() == "ocean");
+    LUMI_CHECK_EQ(lumi.getBright(), 2);
+
+    // Playback carries on from the seek point
+    lumiHostAdvanceMs(60);
+    lumi.update();
+    LUMI_CHECK_EQ(lumi.getRGB().r, 21);
+    LUMI_CHECK(lumi.isTimelinePlaying());
+}
+
+int main() {
+    EEPROM.erase();
+    savePreset();
+    testPlayback();
+    testLoop();
+    testSeek();
+    remove(TEST_FILE);
+    return lumiTestResult("timeline");
+}
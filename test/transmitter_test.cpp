@@ -0,0 +1,109 @@
+/*
+ * AvantLumi Library - Simulated Transmitter Test
+ *
+ * By: AvantMaker.com
+ * Date: August, 2025
+ *
+ * The FastLED shim hands every show() to a hook that plays the transmitter:
+ * it hashes the pixels and the scale they would be sent with. Each sent frame
+ * must be exactly the frame committed by update() with the brightness that
+ * was current at commit, through fades, brightness steps, 16-bit rendering
+ * and double buffering. The library must also leave FastLED's global
+ * brightness alone, since the show task reads it from the other core.
+ *
+ * With double buffering the hook runs on the library's show thread and
+ * takes a while to "clock out" each frame. update() must return while the
+ * frame is still on the wire and render the next one meanwhile, and the
+ * pixels being sent must not change until the transmitter is done.
+ */
+
+#include <AvantLumi.h>
+#include <LumiHost.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "lumi_test.h"
+
+static std::vector<uint32_t> committed;
+static std::vector<uint32_t> transmitted;
+
+static void onFrame(const CRGB* frame, uint16_t count, uint8_t brightness) {
+    committed.push_back(AvantLumi::frameHash(frame, count, brightness));
+}
+
+#define WIRE_US 300   // Real time each frame spends "on the wire"
+
+static std::atomic<bool> inFlight(false);
+static std::atomic<uint32_t> changedInFlight(0);
+
+static void onShow(CLEDController& controller, uint8_t scale) {
+    inFlight = true;
+    uint32_t sent = AvantLumi::frameHash(controller.leds(), controller.size(), scale);
+    std::this_thread::sleep_for(std::chrono::microseconds(WIRE_US));
+    if (AvantLumi::frameHash(controller.leds(), controller.size(), scale) != sent) {
+        changedInFlight++;
+    }
+    transmitted.push_back(sent);
+    inFlight = false;
+}
+
+static void runShow(bool doubleBuffer, bool highPrecision) {
+    FastLED.reset();
+    FastLED.setShowHook(onShow);
+    FastLED.setBrightness(77);   // Application setting the library must not touch
+    committed.clear();
+    transmitted.clear();
+    changedInFlight = 0;
+    uint32_t overlapped = 0;
+
+    AvantLumi lumi(5, 90);
+    LUMI_CHECK(lumi.setDoubleBuffer(doubleBuffer));
+    LUMI_CHECK(lumi.setHighPrecision(highPrecision));
+    lumi.setFrameCallback(onFrame);
+    LUMI_CHECK(lumi.begin());
+    LUMI_CHECK(lumi.setPalette("lava"));
+
+    for (int i = 0; i < 600; i++) {
+        if (i == 100) lumi.setBright(5);
+        if (i == 200) lumi.setBright(1);
+        if (i == 300) lumi.setSwitch(false);
+        if (i == 400) lumi.setSwitch(true);
+        if (i == 500) lumi.setCrossfade(400);
+        if (i == 501) lumi.setPalette("ocean");
+        lumi.update();
+        // Still sending when update() is back: the next frame renders during transmission
+        if (inFlight) {
+            overlapped++;
+        }
+        lumiHostAdvanceMs(10);
+    }
+    // Waits for the last frame on the wire
+    LUMI_CHECK(lumi.setDoubleBuffer(false));
+
+    LUMI_CHECK_EQ(changedInFlight, 0);
+    if (doubleBuffer) {
+        LUMI_CHECK(overlapped > 0);
+    } else {
+        LUMI_CHECK_EQ(overlapped, 0);
+    }
+    LUMI_CHECK(committed.size() > 300);
+    LUMI_CHECK_EQ(transmitted.size(), committed.size());
+    size_t mismatches = 0;
+    for (size_t i = 0; i < committed.size() && i < transmitted.size(); i++) {
+        if (committed[i] != transmitted[i]) {
+            mismatches++;
+        }
+    }
+    LUMI_CHECK_EQ(mismatches, 0);
+    LUMI_CHECK_EQ(FastLED.getBrightness(), 77);
+    FastLED.setShowHook(nullptr);
+}
+
+int main() {
+    runShow(false, false);
+    runShow(true, false);
+    runShow(false, true);
+    runShow(true, true);
+    return lumiTestResult("transmitter_test");
+}
@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+"""
+AvantLumi - embed a web asset as a gzip-compressed PROGMEM array.
+
+Usage:
+    python3 tools/embed_asset.py <input file> <output header> <symbol> [content type]
+
+The generated header defines a LumiAsset named <symbol> for use with
+lumiSendAsset(). The ETag is derived from the compressed bytes, so it changes
+whenever the source changes. Compression is deterministic (no timestamp),
+which keeps regenerated headers stable under version control.
+"""
+
+import gzip
+import hashlib
+import os
+import sys
+
+TYPES = {
+    ".html": "text/html",
+    ".htm": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+    ".json": "application/json",
+    ".svg": "image/svg+xml",
+}
+
+
+def main():
+    if len(sys.argv) < 4:
+        print(__doc__.strip())
+        return 1
+
+    source, header, symbol = sys.argv[1], sys.argv[2], sys.argv[3]
+    content_type = sys.argv[4] if len(sys.argv) > 4 else TYPES.get(
+        os.path.splitext(source)[1].lower(), "application/octet-stream")
+
+    with open(source, "rb") as f:
+        raw = f.read()
+    compressed = gzip.compress(raw, compresslevel=9, mtime=0)
+    etag = '"' + hashlib.sha1(compressed).hexdigest()[:16] + '"'
+
+    guard = symbol.upper() + "_H"
+    lines = [
+        "// Generated by tools/embed_asset.py from %s - do not edit." % os.path.basename(source),
+        "// %d bytes of source, %d bytes gzip-compressed." % (len(raw), len(compressed)),
+        "",
+        "#ifndef %s" % guard,
+        "#define %s" % guard,
+        "",
+        '#include "LumiAsset.h"',
+        "",
+        "const uint8_t %s_gz[] PROGMEM = {" % symbol,
+    ]
+    for i in range(0, len(compressed), 16):
+        chunk = compressed[i:i + 16]
+        lines.append("  " + ", ".join("0x%02x" % b for b in chunk) + ",")
+    lines += [
+        "};",
+        "",
+        "const LumiAsset %s = {" % symbol,
+        "  %s_gz," % symbol,
+        "  sizeof(%s_gz)," % symbol,
+        '  "%s",' % content_type,
+        "  %s" % ('"' + etag.replace('"', '\\"') + '"'),
+        "};",
+        "",
+        "#endif // %s" % guard,
+        "",
+    ]
+
+    with open(header, "w", newline="\n") as f:
+        f.write("\n".join(lines))
+    print("%s: %d -> %d bytes, ETag %s" % (header, len(raw), len(compressed), etag))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())